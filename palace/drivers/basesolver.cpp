@@ -3,9 +3,12 @@
 
 #include "basesolver.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <complex>
 #include <numeric>
+#include <string>
 #include <mfem.hpp>
 #include <nlohmann/json.hpp>
 #include "drivers/transientsolver.hpp"
@@ -13,6 +16,7 @@
 #include "fem/fespace.hpp"
 #include "fem/mesh.hpp"
 #include "linalg/ksp.hpp"
+#include "linalg/vector.hpp"
 #include "models/domainpostoperator.hpp"
 #include "models/portexcitations.hpp"
 #include "models/postoperator.hpp"
@@ -181,22 +185,44 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
                     1 + static_cast<int>(std::log10(refinement.max_it)));
     }
 
+    // Optionally coarsen where the error has become small, and transfer the solutions from
+    // the previous iteration to the coarsened mesh.
+    Vector estimates(indicators.Local());
+    if (refinement.coarsening_fraction > 0.0 && mesh.back()->Get().Nonconforming())
+    {
+      if (mesh::CoarsenMesh(*mesh.back(), estimates, refinement.coarsening_fraction,
+                            refinement.max_nc_levels) > 0)
+      {
+        UpdateWarmStart(mesh.back()->Get());
+      }
+    }
+
     // Mark.
-    const auto marked_elements = [&comm, &refinement](const auto &indicators)
+    const auto marked_elements = [&comm, &refinement](const Vector &estimates)
     {
-      const auto [threshold, marked_error] = utils::ComputeDorflerThreshold(
-          comm, indicators.Local(), refinement.update_fraction);
-      const auto marked_elements = MarkedElements(indicators.Local(), threshold);
+      const auto [threshold, marked_error] =
+          utils::ComputeDorflerThreshold(comm, estimates, refinement.update_fraction);
+      const auto marked_elements = MarkedElements(estimates, threshold);
       const auto [glob_marked_elements, glob_elements] =
-          linalg::GlobalSize2(comm, marked_elements, indicators.Local());
+          linalg::GlobalSize2(comm, marked_elements, estimates);
       Mpi::Print(
           " Marked {:d}/{:d} elements for refinement ({:.2f}% of the error, θ = {:.2f})\n",
           glob_marked_elements, glob_elements, 100 * marked_error,
           refinement.update_fraction);
       return marked_elements;
-    }(indicators);
+    }(estimates);
 
-    // Refine.
+    // Keep a copy of the mesh prior to refinement as a coarse level of the geometric
+    // multigrid hierarchy for the next solve. Only the most recent level is kept, since
+    // the transfer operators rely on the last refinement of the finer mesh.
+    mesh.erase(mesh.begin(), mesh.end() - 1);
+    if (iodata.solver.linear.mg_use_mesh && iodata.solver.linear.mg_max_levels > 1)
+    {
+      auto coarse_mesh = std::make_unique<mfem::ParMesh>(mesh.back()->Get());
+      mesh.insert(mesh.begin(), std::make_unique<Mesh>(std::move(coarse_mesh)));
+    }
+
+    // Refine, and transfer the solutions from the previous iteration to the refined mesh.
     {
       mfem::ParMesh &fine_mesh = *mesh.back();
       const auto initial_elem_count = fine_mesh.GetGlobalNE();
@@ -206,6 +232,7 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
                  fine_mesh.Nonconforming() ? "Nonconforming" : "Conforming",
                  final_elem_count - initial_elem_count, initial_elem_count,
                  final_elem_count);
+      UpdateWarmStart(fine_mesh);
     }
 
     // Optionally rebalance and write the adapted mesh to file.
@@ -213,6 +240,8 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
       const auto ratio_pre = mesh::RebalanceMesh(iodata, *mesh.back());
       if (ratio_pre > refinement.maximum_imbalance)
       {
+        // The rebalanced mesh is no longer a refinement of the coarse level.
+        mesh.erase(mesh.begin(), mesh.end() - 1);
         int min_elem, max_elem;
         min_elem = max_elem = mesh.back()->GetNE();
         Mpi::GlobalMin(1, &min_elem, comm);
@@ -223,6 +252,7 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
                    ratio_pre, refinement.maximum_imbalance, ratio_post);
       }
       mesh.back()->Update();
+      UpdateWarmStart(mesh.back()->Get());
     }
 
     // Solve + estimate.
@@ -237,6 +267,84 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
              (refinement.max_size > 0
                   ? ", max. size = " + std::to_string(refinement.max_size)
                   : ""));
+  warm_fields.clear();
+  warm_fespace.reset();
+  warm_fec.reset();
+}
+
+void BaseSolver::SaveWarmStart(const FiniteElementSpace &fespace, const Vector &x,
+                               int i) const
+{
+  if (iodata.model.refinement.max_it <= 0)
+  {
+    return;
+  }
+  if (warm_fields.empty() || NumWarmStart(fespace) == 0)
+  {
+    warm_fields.clear();
+    warm_fespace.reset();
+    warm_fec.reset(mfem::FiniteElementCollection::New(fespace.GetFEColl().Name()));
+    warm_fespace = std::make_unique<mfem::ParFiniteElementSpace>(
+        fespace.Get().GetParMesh(), warm_fec.get());
+  }
+  MFEM_VERIFY(warm_fespace && i <= static_cast<int>(warm_fields.size()),
+              "Solutions for warm starting must be stored in order!");
+  if (i == static_cast<int>(warm_fields.size()))
+  {
+    warm_fields.emplace_back(std::make_unique<mfem::ParGridFunction>(warm_fespace.get()));
+  }
+  warm_fields[i]->SetFromTrueDofs(x);
+}
+
+int BaseSolver::NumWarmStart(const FiniteElementSpace &fespace) const
+{
+  if (!warm_fespace || warm_fespace->GetParMesh() != fespace.Get().GetParMesh() ||
+      warm_fespace->GetTrueVSize() != fespace.Get().GetTrueVSize() ||
+      std::string(warm_fec->Name()) != fespace.GetFEColl().Name())
+  {
+    return 0;
+  }
+  return static_cast<int>(warm_fields.size());
+}
+
+void BaseSolver::GetWarmStart(const FiniteElementSpace &fespace, int i, Vector &x,
+                              const mfem::Array<int> *dbc_tdof_list) const
+{
+  MFEM_VERIFY(i < NumWarmStart(fespace),
+              "Invalid index or space for AMR warm start solution!");
+  if (!dbc_tdof_list || dbc_tdof_list->Size() == 0)
+  {
+    warm_fields[i]->GetTrueDofs(x);
+    return;
+  }
+
+  // The transferred solution does not in general match the prescribed boundary values on
+  // the new mesh (for example, at boundary dofs introduced by nonconforming refinement), so
+  // these are restored after the transfer.
+  Vector x0(x);
+  warm_fields[i]->GetTrueDofs(x);
+  linalg::SetSubVector(x, *dbc_tdof_list, x0);
+}
+
+void BaseSolver::UpdateWarmStart(const mfem::ParMesh &mesh) const
+{
+  if (!warm_fespace)
+  {
+    return;
+  }
+  if (warm_fespace->GetParMesh() != &mesh)
+  {
+    warm_fields.clear();
+    warm_fespace.reset();
+    warm_fec.reset();
+    return;
+  }
+  warm_fespace->Update();
+  for (auto &gf : warm_fields)
+  {
+    gf->Update();
+  }
+  warm_fespace->UpdatesFinished();
 }
 
 void BaseSolver::SaveMetadata(const FiniteElementSpaceHierarchy &fespaces) const
@@ -8,11 +8,13 @@
 #include <vector>
 #include <fmt/os.h>
 #include "fem/errorindicator.hpp"
+#include "linalg/vector.hpp"
 #include "utils/filesystem.hpp"
 
 namespace palace
 {
 
+class FiniteElementSpace;
 class FiniteElementSpaceHierarchy;
 class IoData;
 class Mesh;
@@ -33,11 +35,39 @@ protected:
   fs::path post_dir;
   bool root;
 
+  // Solutions from the previous adaptive mesh refinement iteration, stored as grid
+  // functions on a copy of the solution space. These are updated along with the mesh
+  // during refinement and rebalancing and used as initial guesses for the next solve.
+  mutable std::unique_ptr<mfem::FiniteElementCollection> warm_fec;
+  mutable std::unique_ptr<mfem::ParFiniteElementSpace> warm_fespace;
+  mutable std::vector<std::unique_ptr<mfem::ParGridFunction>> warm_fields;
+
   // Performs a solve using the mesh sequence, then reports error indicators and the number
   // of global true dofs.
   virtual std::pair<ErrorIndicator, long long int>
   Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const = 0;
 
+  // Store the i-th solution vector (true dofs) for the given space, for warm starting the
+  // next AMR iteration. Solutions stored for the same space are overwritten in place, so a
+  // solution can be read with GetWarmStart before it is replaced. Solutions for a different
+  // space are discarded. Does nothing when AMR is not enabled.
+  void SaveWarmStart(const FiniteElementSpace &fespace, const Vector &x, int i) const;
+
+  // Returns the number of stored solutions from the previous AMR iteration which are
+  // available as initial guesses for the given space.
+  int NumWarmStart(const FiniteElementSpace &fespace) const;
+
+  // Get the i-th stored solution, transferred to the true dofs of the given space. If a
+  // list of essential true dofs is given, the values of x on these dofs (the prescribed
+  // boundary values) are kept.
+  void GetWarmStart(const FiniteElementSpace &fespace, int i, Vector &x,
+                    const mfem::Array<int> *dbc_tdof_list = nullptr) const;
+
+  // Transfer the stored solutions after a modification of the mesh. Nonconforming
+  // rebalancing is handled by the transfer, but if the mesh object has been replaced (by
+  // conformal rebalancing), the solutions are discarded.
+  void UpdateWarmStart(const mfem::ParMesh &mesh) const;
+
 public:
   BaseSolver(const IoData &iodata, bool root, int size = 0, int num_thread = 0,
              const char *git_tag = nullptr);
@@ -105,7 +105,8 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op) const
   TimeDependentFluxErrorEstimator<ComplexVector> estimator(
       space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
       iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
+      iodata.solver.linear.estimator_mg, iodata.solver.linear.estimator_initial_guess,
+      iodata.solver.linear.estimator_adaptive_tol);
   ErrorIndicator indicator;
 
   // If using Floquet BCs, a correction term (kp x E) needs to be added to the B field.
@@ -137,10 +138,19 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op) const
     // Switch paraview subfolders: one for each excitation, if nr_excitations > 1.
     post_op.InitializeParaviewDataCollection(excitation_idx);
 
+    // The solution at the first frequency from the previous AMR iteration is the initial
+    // guess for the first frequency of this excitation, when available.
+    const int warm_idx = excitation_counter - excitation_restart_counter;
+    if (2 * warm_idx + 1 < NumWarmStart(space_op.GetNDSpace()))
+    {
+      GetWarmStart(space_op.GetNDSpace(), 2 * warm_idx, E.Real());
+      GetWarmStart(space_op.GetNDSpace(), 2 * warm_idx + 1, E.Imag());
+    }
+
     // Frequency loop.
-    for (std::size_t omega_i =
-             ((excitation_counter == excitation_restart_counter) ? freq_restart_idx : 0);
-         omega_i < omega_sample.size(); omega_i++)
+    const std::size_t omega_i0 =
+        (excitation_counter == excitation_restart_counter) ? freq_restart_idx : 0;
+    for (std::size_t omega_i = omega_i0; omega_i < omega_sample.size(); omega_i++)
     {
       auto omega = omega_sample[omega_i];
       // Assemble frequency dependent matrices and initialize operators in linear
@@ -167,6 +177,11 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op) const
       space_op.GetExcitationVector(excitation_idx, omega, RHS);
       Mpi::Print("\n");
       ksp.Mult(RHS, E);
+      if (omega_i == omega_i0)
+      {
+        SaveWarmStart(space_op.GetNDSpace(), E.Real(), 2 * warm_idx);
+        SaveWarmStart(space_op.GetNDSpace(), E.Imag(), 2 * warm_idx + 1);
+      }
 
       // Start Post-processing.
       BlockTimer bt0(Timer::POSTPRO);
@@ -237,7 +252,8 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op) const
   TimeDependentFluxErrorEstimator<ComplexVector> estimator(
       space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
       iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
+      iodata.solver.linear.estimator_mg, iodata.solver.linear.estimator_initial_guess,
+      iodata.solver.linear.estimator_adaptive_tol);
   ErrorIndicator indicator;
 
   // If using Floquet BCs, a correction term (kp x E) needs to be added to the B field.
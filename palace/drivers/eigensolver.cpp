@@ -3,11 +3,17 @@
 
 #include "eigensolver.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <numeric>
+#include <utility>
+#include <vector>
 #include <mfem.hpp>
 #include "fem/errorindicator.hpp"
+#include "fem/fespace.hpp"
 #include "fem/mesh.hpp"
 #include "linalg/arpack.hpp"
+#include "linalg/beyn.hpp"
 #include "linalg/divfree.hpp"
 #include "linalg/errorestimator.hpp"
 #include "linalg/floquetcorrection.hpp"
@@ -21,6 +27,7 @@
 #include "models/postoperator.hpp"
 #include "models/spaceoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
 #include "utils/timer.hpp"
 
@@ -29,14 +36,226 @@ namespace palace
 
 using namespace std::complex_literals;
 
+namespace
+{
+
+// Copies an eigenvector computed by the process group h onto all processes. The group mesh
+// holds the elements of each process p together and in their local order on process
+// part_h(p) of the group (see mesh::DistributeMeshToGroup), so the element-local values
+// for the elements of process p are found in a contiguous range of the elements of a
+// single group process. The group space and eigenvector are only given on group h.
+void TransferFromGroup(FiniteElementSpace &fespace, FiniteElementSpace *group_fespace,
+                       const std::vector<int> &group_roots, const std::vector<int> &ne,
+                       int h, const ComplexVector *group_x, ComplexVector &x)
+{
+  MPI_Comm comm = fespace.GetComm();
+  const int size = Mpi::Size(comm), rank = Mpi::Rank(comm);
+  const int n_h = group_roots[h + 1] - group_roots[h];
+  auto GetPart = [&](int p) { return p * n_h / size; };
+  mfem::Array<int> vdofs;
+  mfem::DofTransformation dof_trans;
+  mfem::Vector vals;
+
+  // Element-local values are exchanged as the real part followed by the imaginary part,
+  // for each element in turn.
+  auto GetBufferSize = [&](mfem::ParFiniteElementSpace &fes, int e_begin, int e_end)
+  {
+    int buf_size = 0;
+    for (int e = e_begin; e < e_end; e++)
+    {
+      fes.GetElementVDofs(e, vdofs, dof_trans);
+      buf_size += 2 * vdofs.Size();
+    }
+    return buf_size;
+  };
+  std::vector<MPI_Request> requests;
+  std::vector<std::vector<double>> send_bufs;
+  if (group_x)
+  {
+    MFEM_VERIFY(group_fespace, "Missing process group space for eigenvector transfer!");
+    mfem::ParFiniteElementSpace &fes = group_fespace->Get();
+    mfem::ParGridFunction xr(&fes), xi(&fes);
+    xr.SetFromTrueDofs(group_x->Real());
+    xi.SetFromTrueDofs(group_x->Imag());
+    xr.HostRead();
+    xi.HostRead();
+    const int group_rank = rank - group_roots[h];
+    for (int p = 0, offset = 0; p < size; p++)
+    {
+      if (GetPart(p) != group_rank)
+      {
+        continue;
+      }
+      auto &buf = send_bufs.emplace_back(GetBufferSize(fes, offset, offset + ne[p]));
+      for (int e = offset, k = 0; e < offset + ne[p]; e++)
+      {
+        fes.GetElementVDofs(e, vdofs, dof_trans);
+        for (const auto *xc : {&xr, &xi})
+        {
+          xc->GetSubVector(vdofs, vals);
+          dof_trans.InvTransformPrimal(vals);
+          std::copy(vals.begin(), vals.end(), buf.begin() + k);
+          k += vals.Size();
+        }
+      }
+      MPI_Isend(buf.data(), static_cast<int>(buf.size()), MPI_DOUBLE, p, 0, comm,
+                &requests.emplace_back());
+      offset += ne[p];
+    }
+  }
+
+  mfem::ParFiniteElementSpace &fes = fespace.Get();
+  const int ne_loc = fespace.GetParMesh().GetNE();
+  std::vector<double> recv_buf(GetBufferSize(fes, 0, ne_loc));
+  MPI_Recv(recv_buf.data(), static_cast<int>(recv_buf.size()), MPI_DOUBLE,
+           group_roots[h] + GetPart(rank), 0, comm, MPI_STATUS_IGNORE);
+  mfem::ParGridFunction xr(&fes), xi(&fes);
+  xr.HostWrite();
+  xi.HostWrite();
+  for (int e = 0, k = 0; e < ne_loc; e++)
+  {
+    fes.GetElementVDofs(e, vdofs, dof_trans);
+    vals.SetSize(vdofs.Size());
+    for (auto *xc : {&xr, &xi})
+    {
+      std::copy(recv_buf.begin() + k, recv_buf.begin() + k + vals.Size(), vals.begin());
+      dof_trans.TransformPrimal(vals);
+      xc->SetSubVector(vdofs, vals);
+      k += vals.Size();
+    }
+  }
+  x.SetSize(fespace.GetTrueVSize());
+  x.UseDevice(true);
+  xr.ParallelProject(x.Real());
+  xi.ParallelProject(x.Imag());
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+}  // namespace
+
 std::pair<ErrorIndicator, long long int>
 EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
 {
-  // Construct and extract the system matrices defining the eigenvalue problem. The diagonal
-  // values for the mass matrix PEC dof shift the Dirichlet eigenvalues out of the
-  // computational range. The damping matrix may be nullptr.
+  // Construct the operators for the eigenvalue problem, and those for postprocessing.
   BlockTimer bt0(Timer::CONSTRUCT);
   SpaceOperator space_op(iodata, mesh);
+  const auto &Curl = space_op.GetCurlMatrix();
+  SaveMetadata(space_op.GetNDSpaces());
+
+  // Configure objects for postprocessing.
+  PostOperator<ProblemType::EIGENMODE> post_op(iodata, space_op);
+  ComplexVector E(Curl.Width()), B(Curl.Height());
+  E.UseDevice(true);
+  B.UseDevice(true);
+
+  // If using Floquet BCs, a correction term (kp x E) needs to be added to the B field.
+  std::unique_ptr<FloquetCorrSolver<ComplexVector>> floquet_corr;
+  if (space_op.GetMaterialOp().HasWaveVector())
+  {
+    floquet_corr = std::make_unique<FloquetCorrSolver<ComplexVector>>(
+        space_op.GetMaterialOp(), space_op.GetNDSpace(), space_op.GetRTSpace(),
+        iodata.solver.linear.tol, iodata.solver.linear.max_it, 0);
+  }
+
+  // Initialize structures for storing and reducing the results of error estimation.
+  TimeDependentFluxErrorEstimator<ComplexVector> estimator(
+      space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
+      iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
+      iodata.solver.linear.estimator_mg, iodata.solver.linear.estimator_initial_guess,
+      iodata.solver.linear.estimator_adaptive_tol);
+  ErrorIndicator indicator;
+
+  // The spectrum slices are solved concurrently by separate groups of processes when there
+  // are several slices and processes. Each group solves on its own copy of the finest mesh,
+  // which requires a conformal mesh. Otherwise, all slices are solved in turn.
+  const int n_slices = iodata.solver.eigenmode.n_slices;
+  int n_groups = std::min(n_slices, Mpi::Size(space_op.GetComm()));
+  if (n_groups > 1 && !mesh.back()->Get().Conforming())
+  {
+    Mpi::Warning("Spectrum slices are solved one after another for nonconformal meshes!\n");
+    n_groups = 1;
+  }
+  std::vector<Eigenpair> modes;
+  if (n_groups > 1)
+  {
+    modes = SolveSlicesInGroups(mesh, space_op.GetNDSpace(), n_groups);
+  }
+  else
+  {
+    std::vector<int> slices(n_slices);
+    std::iota(slices.begin(), slices.end(), 0);
+    modes = SolveSlices(space_op, slices, true);
+  }
+  int num_conv = static_cast<int>(modes.size());
+
+  BlockTimer bt2(Timer::POSTPRO);
+
+  // Calculate and record the error indicators, and postprocess the results.
+  Mpi::Print("\nComputing solution error estimates and performing postprocessing\n\n");
+
+  // With multiple slices, order the merged eigenpairs by increasing frequency.
+  if (n_slices > 1)
+  {
+    std::stable_sort(modes.begin(), modes.end(), [](const auto &m1, const auto &m2)
+                     { return m1.omega.real() < m2.omega.real(); });
+  }
+
+  for (int i = 0; i < num_conv; i++)
+  {
+    // Get the eigenvalue and relative error.
+    std::complex<double> omega = modes[i].omega;
+    double error_bkwd = modes[i].error_bkwd;
+    double error_abs = modes[i].error_abs;
+
+    // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
+    // PostOperator for all postprocessing operations.
+    E = modes[i].E;
+    modes[i].E.Real().Destroy();
+    modes[i].E.Imag().Destroy();
+
+    linalg::NormalizePhase(space_op.GetComm(), E);
+
+    Curl.Mult(E.Real(), B.Real());
+    Curl.Mult(E.Imag(), B.Imag());
+    B *= -1.0 / (1i * omega);
+    if (space_op.GetMaterialOp().HasWaveVector())
+    {
+      // Calculate B field correction for Floquet BCs.
+      // B = -1/(iω) ∇ x E + 1/ω kp x E.
+      floquet_corr->AddMult(E, B, 1.0 / omega);
+    }
+
+    auto total_domain_energy =
+        post_op.MeasureAndPrintAll(i, E, B, omega, error_abs, error_bkwd, num_conv);
+
+    // Calculate and record the error indicators.
+    if (i < iodata.solver.eigenmode.n)
+    {
+      estimator.AddErrorIndicator(E, B, total_domain_energy, indicator);
+      SaveWarmStart(space_op.GetNDSpace(), E.Real(), 2 * i);
+      SaveWarmStart(space_op.GetNDSpace(), E.Imag(), 2 * i + 1);
+    }
+
+    // Final write: Different condition than end of loop (i = num_conv - 1).
+    if (i == iodata.solver.eigenmode.n - 1)
+    {
+      post_op.MeasureFinalize(indicator);
+    }
+  }
+  MFEM_VERIFY(num_conv >= iodata.solver.eigenmode.n, "Eigenmode solve only found "
+                                                         << num_conv << " modes when "
+                                                         << iodata.solver.eigenmode.n
+                                                         << " were requested!");
+  return {indicator, space_op.GlobalTrueVSize()};
+}
+
+std::vector<EigenSolver::Eigenpair>
+EigenSolver::SolveSlices(SpaceOperator &space_op, const std::vector<int> &slices,
+                         bool warm_start) const
+{
+  // Extract the system matrices defining the eigenvalue problem. The diagonal values for
+  // the mass matrix PEC dof shift the Dirichlet eigenvalues out of the computational range.
+  // The damping matrix may be nullptr.
   auto K = space_op.GetStiffnessMatrix<ComplexOperator>(Operator::DIAG_ONE);
   auto C = space_op.GetDampingMatrix<ComplexOperator>(Operator::DIAG_ZERO);
   auto M = space_op.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
@@ -58,6 +277,13 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   std::unique_ptr<Interpolation> interp_op;
   std::unique_ptr<ComplexOperator> A2_0, A2_1, A2_2;
   NonlinearEigenSolver nonlinear_type = iodata.solver.eigenmode.nonlinear_type;
+  const bool contour = (iodata.solver.eigenmode.contour_n_points > 0);
+  if (contour && nonlinear_type == NonlinearEigenSolver::SLP)
+  {
+    Mpi::Warning("SLP nonlinear eigensolver not available with the contour-integral "
+                 "eigenvalue solver, using Hybrid!\n");
+    nonlinear_type = NonlinearEigenSolver::HYBRID;
+  }
   if (has_A2 && nonlinear_type == NonlinearEigenSolver::HYBRID)
   {
     const double target_max = iodata.solver.eigenmode.target_upper;
@@ -71,21 +297,8 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     Mp = BuildParSumOperator({1.0 + 0i, 1.0 + 0i}, {M.get(), A2_2.get()});
   }
 
-  const auto &Curl = space_op.GetCurlMatrix();
-  SaveMetadata(space_op.GetNDSpaces());
-
-  // Configure objects for postprocessing.
-  PostOperator<ProblemType::EIGENMODE> post_op(iodata, space_op);
-  ComplexVector E(Curl.Width()), B(Curl.Height());
-  E.UseDevice(true);
-  B.UseDevice(true);
-
-  // Define and configure the eigensolver to solve the eigenvalue problem:
-  //         (K + λ C + λ² M) u = 0    or    K u = -λ² M u
-  // with λ = iω. In general, the system matrices are complex and symmetric.
-  std::unique_ptr<EigenvalueSolver> eigen;
+  // Select the eigenvalue solver backend.
   EigenSolverBackend type = iodata.solver.eigenmode.type;
-
 #if defined(PALACE_WITH_ARPACK) && defined(PALACE_WITH_SLEPC)
   if (type == EigenSolverBackend::DEFAULT)
   {
@@ -111,110 +324,34 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
 #else
 #error "Eigenmode solver requires building with ARPACK or SLEPc!"
 #endif
-  if (type == EigenSolverBackend::ARPACK)
-  {
-#if defined(PALACE_WITH_ARPACK)
-    Mpi::Print("\nConfiguring ARPACK eigenvalue solver:\n");
-    if (C || has_A2)
-    {
-      eigen = std::make_unique<arpack::ArpackPEPSolver>(space_op.GetComm(),
-                                                        iodata.problem.verbose);
-    }
-    else
-    {
-      eigen = std::make_unique<arpack::ArpackEPSSolver>(space_op.GetComm(),
-                                                        iodata.problem.verbose);
-    }
-#endif
-  }
-  else  // EigenSolverBackend::SLEPC
-  {
-#if defined(PALACE_WITH_SLEPC)
-    Mpi::Print("\nConfiguring SLEPc eigenvalue solver:\n");
-    std::unique_ptr<slepc::SlepcEigenvalueSolver> slepc;
-    if (nonlinear_type == NonlinearEigenSolver::SLP)
-    {
-      slepc = std::make_unique<slepc::SlepcNEPSolver>(space_op.GetComm(),
-                                                      iodata.problem.verbose);
-      slepc->SetType(slepc::SlepcEigenvalueSolver::Type::SLP);
-      slepc->SetProblemType(slepc::SlepcEigenvalueSolver::ProblemType::GENERAL);
-    }
-    else
-    {
-      if (C || has_A2)
-      {
-        if (!iodata.solver.eigenmode.pep_linear)
-        {
-          slepc = std::make_unique<slepc::SlepcPEPSolver>(space_op.GetComm(),
-                                                          iodata.problem.verbose);
-          slepc->SetType(slepc::SlepcEigenvalueSolver::Type::TOAR);
-        }
-        else
-        {
-          slepc = std::make_unique<slepc::SlepcPEPLinearSolver>(space_op.GetComm(),
-                                                                iodata.problem.verbose);
-          slepc->SetType(slepc::SlepcEigenvalueSolver::Type::KRYLOVSCHUR);
-        }
-      }
-      else
-      {
-        slepc = std::make_unique<slepc::SlepcEPSSolver>(space_op.GetComm(),
-                                                        iodata.problem.verbose);
-        slepc->SetType(slepc::SlepcEigenvalueSolver::Type::KRYLOVSCHUR);
-      }
-      slepc->SetProblemType(slepc::SlepcEigenvalueSolver::ProblemType::GEN_NON_HERMITIAN);
-    }
-    slepc->SetOrthogonalization(iodata.solver.linear.gs_orthog == Orthogonalization::MGS,
-                                iodata.solver.linear.gs_orthog == Orthogonalization::CGS2);
-    eigen = std::move(slepc);
-#endif
-  }
-  EigenvalueSolver::ScaleType scale = iodata.solver.eigenmode.scale
-                                          ? EigenvalueSolver::ScaleType::NORM_2
-                                          : EigenvalueSolver::ScaleType::NONE;
-  if (nonlinear_type == NonlinearEigenSolver::SLP)
-  {
-    eigen->SetOperators(*K, *C, *M, EigenvalueSolver::ScaleType::NONE);
-    eigen->SetExtraSystemMatrix(funcA2);
-    eigen->SetPreconditionerUpdate(funcP);
-  }
-  else
+
+  // The search range [target, target_upper] is optionally split into a number of spectrum
+  // slices, each of which is solved with its own shift-and-invert target and only a
+  // fraction of the total number of requested eigenmodes. This keeps the subspace dimension
+  // (and the cost of orthogonalization) for each solve small when many modes are sought.
+  const int n_slices = iodata.solver.eigenmode.n_slices;
+  const int n_slice_modes = (iodata.solver.eigenmode.n + n_slices - 1) / n_slices;
+  auto GetSliceTarget = [&](int s)
+  { return target + (iodata.solver.eigenmode.target_upper - target) * s / n_slices; };
+
+  // The number of modes for a slice may be increased beyond its initial value to cover the
+  // slice, in which case a configured maximum subspace dimension may need to grow with it.
+  auto GetSubspaceSize = [&](int nev)
   {
-    if (has_A2)
-    {
-      eigen->SetOperators(*Kp, *Cp, *Mp, scale);
-    }
-    else if (C)
-    {
-      eigen->SetOperators(*K, *C, *M, scale);
-    }
-    else
-    {
-      eigen->SetOperators(*K, *M, scale);
-    }
-  }
-  eigen->SetNumModes(iodata.solver.eigenmode.n, iodata.solver.eigenmode.max_size);
-  const double tol = (has_A2 && nonlinear_type == NonlinearEigenSolver::HYBRID)
-                         ? iodata.solver.eigenmode.linear_tol
-                         : iodata.solver.eigenmode.tol;
-  eigen->SetTol(tol);
-  eigen->SetMaxIter(iodata.solver.eigenmode.max_it);
-  Mpi::Print(" Scaling γ = {:.3e}, δ = {:.3e}\n", eigen->GetScalingGamma(),
-             eigen->GetScalingDelta());
-
-  // If desired, use an M-inner product for orthogonalizing the eigenvalue subspace. The
-  // constructed matrix just references the real SPD part of the mass matrix (no copy is
-  // performed). Boundary conditions don't need to be eliminated here.
+    const int max_size = iodata.solver.eigenmode.max_size;
+    return (max_size > 0 && nev > n_slice_modes) ? std::max(max_size, 2 * nev) : max_size;
+  };
+
+  // Construct the objects which are shared between all slices. If desired, use an
+  // M-inner product for orthogonalizing the eigenvalue subspace. The constructed matrix
+  // just references the real SPD part of the mass matrix (no copy is performed). Boundary
+  // conditions don't need to be eliminated here.
   std::unique_ptr<Operator> KM;
   if (iodata.solver.eigenmode.mass_orthog)
   {
-    Mpi::Print(" Basis uses M-inner product\n");
     KM = space_op.GetInnerProductMatrix(0.0, 1.0, nullptr, M.get());
-    eigen->SetBMat(*KM);
 
-    // Mpi::Print(" Basis uses (K + M)-inner product\n");
     // KM = space_op.GetInnerProductMatrix(1.0, 1.0, K.get(), M.get());
-    // eigen->SetBMat(*KM);
   }
 
   // Construct a divergence-free projector so the eigenvalue solve is performed in the space
@@ -224,44 +361,46 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
       !space_op.GetMaterialOp().HasWaveVector() &&
       !space_op.GetMaterialOp().HasLondonDepth())
   {
-    Mpi::Print(" Configuring divergence-free projection\n");
     constexpr int divfree_verbose = 0;
     divfree = std::make_unique<DivFreeSolver<ComplexVector>>(
         space_op.GetMaterialOp(), space_op.GetNDSpace(), space_op.GetH1Spaces(),
         space_op.GetAuxBdrTDofLists(), iodata.solver.linear.divfree_tol,
         iodata.solver.linear.divfree_max_it, divfree_verbose);
-    eigen->SetDivFreeProjector(*divfree);
-  }
-
-  // If using Floquet BCs, a correction term (kp x E) needs to be added to the B field.
-  std::unique_ptr<FloquetCorrSolver<ComplexVector>> floquet_corr;
-  if (space_op.GetMaterialOp().HasWaveVector())
-  {
-    floquet_corr = std::make_unique<FloquetCorrSolver<ComplexVector>>(
-        space_op.GetMaterialOp(), space_op.GetNDSpace(), space_op.GetRTSpace(),
-        iodata.solver.linear.tol, iodata.solver.linear.max_it, 0);
   }
 
   // Set up the initial space for the eigenvalue solve. Satisfies boundary conditions and is
-  // projected appropriately.
+  // projected appropriately. When available, the sum of the eigenvectors from the previous
+  // AMR iteration is used instead, if requested.
+  ComplexVector v0;
+  const int num_warm = warm_start ? NumWarmStart(space_op.GetNDSpace()) / 2 : 0;
   if (iodata.solver.eigenmode.init_v0)
   {
-    ComplexVector v0;
-    if (iodata.solver.eigenmode.init_v0_const)
+    if (num_warm > 0)
+    {
+      Vector v;
+      v0.SetSize(space_op.GetNDSpace().GetTrueVSize());
+      v0.UseDevice(true);
+      v0 = 0.0;
+      for (int i = 0; i < num_warm; i++)
+      {
+        GetWarmStart(space_op.GetNDSpace(), 2 * i, v);
+        v0.Real() += v;
+        GetWarmStart(space_op.GetNDSpace(), 2 * i + 1, v);
+        v0.Imag() += v;
+      }
+    }
+    else if (iodata.solver.eigenmode.init_v0_const)
     {
-      Mpi::Print(" Using constant starting vector\n");
       space_op.GetConstantInitialVector(v0);
     }
     else
     {
-      Mpi::Print(" Using random starting vector\n");
       space_op.GetRandomInitialVector(v0);
     }
     if (divfree)
     {
       divfree->Mult(v0);
     }
-    eigen->SetInitialSpace(v0);  // Copies the vector
 
     // Debug
     // const auto &Grad = space_op.GetGradMatrix();
@@ -272,183 +411,493 @@ EigenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     // r0.Print();
   }
 
-  // Configure the shift-and-invert strategy is employed to solve for the eigenvalues
-  // closest to the specified target, σ.
-  {
-    const double f_target =
-        iodata.units.Dimensionalize<Units::ValueType::FREQUENCY>(target);
-    Mpi::Print(" Shift-and-invert σ = {:.3e} GHz ({:.3e})\n", f_target, target);
-  }
-  if (C || has_A2 || nonlinear_type == NonlinearEigenSolver::SLP)
+  // Define and configure the eigensolver to solve the eigenvalue problem:
+  //         (K + λ C + λ² M) u = 0    or    K u = -λ² M u
+  // with λ = iω. In general, the system matrices are complex and symmetric. The
+  // shift-and-invert strategy is employed to solve for the eigenvalues closest to the
+  // specified target, σ. Alternatively, the contour-integral eigenvalue solver computes all
+  // eigenvalues with frequencies in [σ, σ_upper].
+  auto ConfigureEigenSolver = [&](double sigma, double sigma_upper,
+                                  int nev) -> std::unique_ptr<EigenvalueSolver>
   {
-    // Search for eigenvalues closest to λ = iσ.
-    eigen->SetShiftInvert(1i * target);
-    if (type == EigenSolverBackend::ARPACK)
+    std::unique_ptr<EigenvalueSolver> eigen;
+    if (contour)
+    {
+      Mpi::Print("\nConfiguring contour-integral eigenvalue solver:\n");
+      auto beyn = std::make_unique<BeynSolver>(space_op.GetComm(), iodata.problem.verbose);
+
+      // The contour is an ellipse in the λ = iω plane enclosing the frequency range
+      // [σ, σ_upper], extending along the imaginary frequency axis by half of its width.
+      // The system matrix at each quadrature node is assembled in the same way as for the
+      // frequency domain driven solver.
+      const double a = 0.5 * (sigma_upper - sigma);
+      beyn->SetContour(1i * (sigma + a), 0.5 * a, a,
+                       iodata.solver.eigenmode.contour_n_points);
+      beyn->SetSystemMatrixUpdate(
+          [&](std::complex<double> l) -> std::unique_ptr<ComplexOperator>
+          {
+            return has_A2 ? space_op.GetSystemMatrix(1.0 + 0.0i, l, l * l, Kp.get(),
+                                                     Cp.get(), Mp.get())
+                          : space_op.GetSystemMatrix(1.0 + 0.0i, l, l * l, K.get(),
+                                                     C.get(), M.get());
+          });
+      beyn->SetPreconditionerUpdate(funcP);
+      Mpi::Print(" Contour with {:d} quadrature points\n",
+                 iodata.solver.eigenmode.contour_n_points);
+      eigen = std::move(beyn);
+    }
+    else if (type == EigenSolverBackend::ARPACK)
+    {
+#if defined(PALACE_WITH_ARPACK)
+      Mpi::Print("\nConfiguring ARPACK eigenvalue solver:\n");
+      if (C || has_A2)
+      {
+        eigen = std::make_unique<arpack::ArpackPEPSolver>(space_op.GetComm(),
+                                                          iodata.problem.verbose);
+      }
+      else
+      {
+        eigen = std::make_unique<arpack::ArpackEPSSolver>(space_op.GetComm(),
+                                                          iodata.problem.verbose);
+      }
+#endif
+    }
+    else  // EigenSolverBackend::SLEPC
     {
-      // ARPACK searches based on eigenvalues of the transformed problem. The eigenvalue
-      // 1 / (λ - σ) will be a large-magnitude negative imaginary number for an eigenvalue
-      // λ with frequency close to but not below the target σ.
-      eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::SMALLEST_IMAGINARY);
+#if defined(PALACE_WITH_SLEPC)
+      Mpi::Print("\nConfiguring SLEPc eigenvalue solver:\n");
+      std::unique_ptr<slepc::SlepcEigenvalueSolver> slepc;
+      if (nonlinear_type == NonlinearEigenSolver::SLP)
+      {
+        slepc = std::make_unique<slepc::SlepcNEPSolver>(space_op.GetComm(),
+                                                        iodata.problem.verbose);
+        slepc->SetType(slepc::SlepcEigenvalueSolver::Type::SLP);
+        slepc->SetProblemType(slepc::SlepcEigenvalueSolver::ProblemType::GENERAL);
+      }
+      else
+      {
+        if (C || has_A2)
+        {
+          if (!iodata.solver.eigenmode.pep_linear)
+          {
+            slepc = std::make_unique<slepc::SlepcPEPSolver>(space_op.GetComm(),
+                                                            iodata.problem.verbose);
+            slepc->SetType(slepc::SlepcEigenvalueSolver::Type::TOAR);
+          }
+          else
+          {
+            slepc = std::make_unique<slepc::SlepcPEPLinearSolver>(space_op.GetComm(),
+                                                                  iodata.problem.verbose);
+            slepc->SetType(slepc::SlepcEigenvalueSolver::Type::KRYLOVSCHUR);
+          }
+        }
+        else
+        {
+          slepc = std::make_unique<slepc::SlepcEPSSolver>(space_op.GetComm(),
+                                                          iodata.problem.verbose);
+          slepc->SetType(slepc::SlepcEigenvalueSolver::Type::KRYLOVSCHUR);
+        }
+        slepc->SetProblemType(
+            slepc::SlepcEigenvalueSolver::ProblemType::GEN_NON_HERMITIAN);
+      }
+      slepc->SetOrthogonalization(iodata.solver.linear.gs_orthog == Orthogonalization::MGS,
+                                  iodata.solver.linear.gs_orthog ==
+                                      Orthogonalization::CGS2);
+      eigen = std::move(slepc);
+#endif
     }
-    else if (nonlinear_type == NonlinearEigenSolver::SLP)
+    EigenvalueSolver::ScaleType scale = iodata.solver.eigenmode.scale
+                                            ? EigenvalueSolver::ScaleType::NORM_2
+                                            : EigenvalueSolver::ScaleType::NONE;
+    if (nonlinear_type == NonlinearEigenSolver::SLP)
     {
-      eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::TARGET_MAGNITUDE);
+      eigen->SetOperators(*K, *C, *M, EigenvalueSolver::ScaleType::NONE);
+      eigen->SetExtraSystemMatrix(funcA2);
+      eigen->SetPreconditionerUpdate(funcP);
     }
     else
     {
-      eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::TARGET_IMAGINARY);
+      if (has_A2)
+      {
+        eigen->SetOperators(*Kp, *Cp, *Mp, scale);
+      }
+      else if (C)
+      {
+        eigen->SetOperators(*K, *C, *M, scale);
+      }
+      else
+      {
+        eigen->SetOperators(*K, *M, scale);
+      }
+    }
+    eigen->SetNumModes(nev, GetSubspaceSize(nev));
+    const double tol = (has_A2 && nonlinear_type == NonlinearEigenSolver::HYBRID)
+                           ? iodata.solver.eigenmode.linear_tol
+                           : iodata.solver.eigenmode.tol;
+    eigen->SetTol(tol);
+    eigen->SetMaxIter(iodata.solver.eigenmode.max_it);
+    Mpi::Print(" Scaling γ = {:.3e}, δ = {:.3e}\n", eigen->GetScalingGamma(),
+               eigen->GetScalingDelta());
+    if (KM)
+    {
+      Mpi::Print(" Basis uses M-inner product\n");
+      eigen->SetBMat(*KM);
     }
-  }
-  else
-  {
-    // Linear EVP has eigenvalues μ = -λ² = ω². Search for eigenvalues closest to μ = σ².
-    eigen->SetShiftInvert(target * target);
-    if (type == EigenSolverBackend::ARPACK)
+    if (divfree)
+    {
+      Mpi::Print(" Configuring divergence-free projection\n");
+      eigen->SetDivFreeProjector(*divfree);
+    }
+    if (iodata.solver.eigenmode.init_v0)
+    {
+      Mpi::Print(" Using {} starting vector\n",
+                 (num_warm > 0) ? "previous AMR iteration"
+                 : iodata.solver.eigenmode.init_v0_const ? "constant"
+                                                         : "random");
+      eigen->SetInitialSpace(v0);  // Copies the vector
+    }
+
+    {
+      const double f_target =
+          iodata.units.Dimensionalize<Units::ValueType::FREQUENCY>(sigma);
+      Mpi::Print(" Shift-and-invert σ = {:.3e} GHz ({:.3e})\n", f_target, sigma);
+    }
+    if (C || has_A2 || nonlinear_type == NonlinearEigenSolver::SLP)
     {
-      // ARPACK searches based on eigenvalues of the transformed problem. 1 / (μ - σ²)
-      // will be a large-magnitude positive real number for an eigenvalue μ with frequency
-      // close to but below the target σ².
-      eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::LARGEST_REAL);
+      // Search for eigenvalues closest to λ = iσ.
+      eigen->SetShiftInvert(1i * sigma);
+      if (type == EigenSolverBackend::ARPACK)
+      {
+        // ARPACK searches based on eigenvalues of the transformed problem. The eigenvalue
+        // 1 / (λ - σ) will be a large-magnitude negative imaginary number for an
+        // eigenvalue λ with frequency close to but not below the target σ.
+        eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::SMALLEST_IMAGINARY);
+      }
+      else if (nonlinear_type == NonlinearEigenSolver::SLP)
+      {
+        eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::TARGET_MAGNITUDE);
+      }
+      else
+      {
+        eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::TARGET_IMAGINARY);
+      }
     }
     else
     {
-      eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::TARGET_REAL);
+      // Linear EVP has eigenvalues μ = -λ² = ω². Search for eigenvalues closest to μ = σ².
+      eigen->SetShiftInvert(sigma * sigma);
+      if (type == EigenSolverBackend::ARPACK)
+      {
+        // ARPACK searches based on eigenvalues of the transformed problem. 1 / (μ - σ²)
+        // will be a large-magnitude positive real number for an eigenvalue μ with
+        // frequency close to but below the target σ².
+        eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::LARGEST_REAL);
+      }
+      else
+      {
+        eigen->SetWhichEigenpairs(EigenvalueSolver::WhichType::TARGET_REAL);
+      }
     }
-  }
+    return eigen;
+  };
 
-  // Set up the linear solver required for solving systems involving the shifted operator
-  // (K - σ² M) or P(iσ) = (K + iσ C - σ² M) during the eigenvalue solve. The
-  // preconditioner for complex linear systems is constructed from a real approximation
-  // to the complex system matrix.
-  auto A = space_op.GetSystemMatrix(1.0 + 0.0i, 1i * target, -target * target + 0.0i,
-                                    K.get(), C.get(), M.get(), A2.get());
-  auto P = space_op.GetPreconditionerMatrix<ComplexOperator>(
-      1.0 + 0.0i, 1i * target, -target * target + 0.0i, target);
+  // Converts a computed eigenvalue to the (complex) frequency ω.
+  auto GetFrequency = [&](const EigenvalueSolver &eigen, int i)
+  {
+    std::complex<double> omega = eigen.GetEigenvalue(i);
+    if (!C && !has_A2 && !contour)
+    {
+      // Linear EVP has eigenvalue μ = -λ² = ω².
+      return std::sqrt(omega);
+    }
+    // Quadratic EVP solves for eigenvalue λ = iω.
+    return omega / 1i;
+  };
+
+  // The linear solver required for solving systems involving the shifted operator
+  // (K - σ² M) or P(iσ) = (K + iσ C - σ² M) during the eigenvalue solve is shared across
+  // slices and is only updated with new operators for each shift. The preconditioner for
+  // complex linear systems is constructed from a real approximation to the complex system
+  // matrix.
   auto ksp = std::make_unique<ComplexKspSolver>(iodata, space_op.GetNDSpaces(),
                                                 &space_op.GetH1Spaces());
-  ksp->SetOperators(*A, *P);
-  eigen->SetLinearSolver(*ksp);
-
-  // Initialize structures for storing and reducing the results of error estimation.
-  TimeDependentFluxErrorEstimator<ComplexVector> estimator(
-      space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
-      iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
-  ErrorIndicator indicator;
-
-  // Eigenvalue problem solve.
-  BlockTimer bt1(Timer::EPS);
-  Mpi::Print("\n");
-  int num_conv = eigen->Solve();
+  // The frequency-dependent operator A2 is evaluated at the shift of each slice rather than
+  // at the global target.
+  std::unique_ptr<ComplexOperator> A, P, A2_s;
+  auto SetShiftedOperators = [&](double sigma)
+  {
+    A2_s.reset();
+    if (has_A2 && sigma != target)
+    {
+      A2_s = funcA2(sigma);
+    }
+    auto A_s = space_op.GetSystemMatrix(1.0 + 0.0i, 1i * sigma, -sigma * sigma + 0.0i,
+                                        K.get(), C.get(), M.get(),
+                                        (sigma != target) ? A2_s.get() : A2.get());
+    auto P_s = space_op.GetPreconditionerMatrix<ComplexOperator>(
+        1.0 + 0.0i, 1i * sigma, -sigma * sigma + 0.0i, sigma);
+    ksp->SetOperators(*A_s, *P_s);
+    A = std::move(A_s);
+    P = std::move(P_s);
+  };
+
+  // Normalize the eigenvectors with respect to the mass matrix (unit electric field
+  // energy) even if they are not computed to be orthogonal with respect to it.
+  std::unique_ptr<Operator> KN;
+  if (!KM)
   {
-    std::complex<double> lambda = (num_conv > 0) ? eigen->GetEigenvalue(0) : 0.0;
-    Mpi::Print(" Found {:d} converged eigenvalue{}{}\n", num_conv,
-               (num_conv > 1) ? "s" : "",
-               (num_conv > 0)
-                   ? fmt::format(" (first = {:.3e}{:+.3e}i)", lambda.real(), lambda.imag())
-                   : "");
+    KN = space_op.GetInnerProductMatrix(0.0, 1.0, nullptr, M.get());
   }
 
-  if (has_A2 && nonlinear_type == NonlinearEigenSolver::HYBRID)
+  // Eigenvalue problem solve, for each slice. Converged eigenpairs are copied out of the
+  // eigenvalue solver for each slice, which is destroyed before the next one starts, and
+  // retained only if their frequency lies within the slice interval, which removes
+  // duplicates found by neighboring slices.
+  BlockTimer bt1(Timer::EPS);
+  std::vector<Eigenpair> modes;
+  for (int s : slices)
   {
-    Mpi::Print("\n Refining eigenvalues with Quasi-Newton solver\n");
-    auto qn = std::make_unique<QuasiNewtonSolver>(space_op.GetComm(), std::move(eigen),
-                                                  num_conv, iodata.problem.verbose,
-                                                  iodata.solver.eigenmode.refine_nonlinear);
-    qn->SetTol(iodata.solver.eigenmode.tol);
-    qn->SetMaxIter(iodata.solver.eigenmode.max_it);
-    if (C)
+    const double sigma = GetSliceTarget(s);
+    const double sigma_upper = GetSliceTarget(s + 1);
+    if (n_slices > 1)
     {
-      qn->SetOperators(*K, *C, *M, EigenvalueSolver::ScaleType::NONE);
+      const double f_lower =
+          iodata.units.Dimensionalize<Units::ValueType::FREQUENCY>(sigma);
+      const double f_upper =
+          iodata.units.Dimensionalize<Units::ValueType::FREQUENCY>(sigma_upper);
+      Mpi::Print("\nSpectrum slice {:d}/{:d}: f ∈ [{:.3e}, {:.3e}) GHz\n", s + 1,
+                 n_slices, f_lower, f_upper);
     }
-    else
+
+    // The shift-and-invert solve for a slice finds the eigenvalues closest to its lower
+    // end, so all eigenvalues in the slice are found only if the converged ones reach its
+    // upper end. Otherwise, the number of modes for the slice is doubled and the slice is
+    // solved again, up to the total number of requested modes. This is not required for
+    // the last slice, which keeps the modes above the range, or once the retained modes
+    // already include the requested number with lowest frequencies.
+    std::unique_ptr<EigenvalueSolver> eigen;
+    int num_conv = 0, nev = n_slice_modes;
+    while (true)
     {
-      qn->SetOperators(*K, *M, EigenvalueSolver::ScaleType::NONE);
-    }
-    qn->SetExtraSystemMatrix(funcA2);
-    qn->SetPreconditionerUpdate(funcP);
-    qn->SetNumModes(iodata.solver.eigenmode.n, iodata.solver.eigenmode.max_size);
-    qn->SetPreconditionerLag(iodata.solver.eigenmode.preconditioner_lag,
-                             iodata.solver.eigenmode.preconditioner_lag_tol);
-    qn->SetMaxRestart(iodata.solver.eigenmode.max_restart);
-    qn->SetLinearSolver(*ksp);
-    qn->SetShiftInvert(1i * target);
-    eigen = std::move(qn);
-
-    // Suppress wave port output during nonlinear eigensolver iterations.
-    space_op.GetWavePortOp().SetSuppressOutput(true);
-    num_conv = eigen->Solve();
-    space_op.GetWavePortOp().SetSuppressOutput(false);
-  }
+      eigen = ConfigureEigenSolver(sigma, sigma_upper, nev);
 
-  BlockTimer bt2(Timer::POSTPRO);
+      // Set up the shifted system matrix and preconditioner for this slice. The
+      // contour-integral solver configures the linear solver at each quadrature node
+      // itself.
+      if (!contour)
+      {
+        SetShiftedOperators(sigma);
+      }
+      eigen->SetLinearSolver(*ksp);
+
+      Mpi::Print("\n");
+      num_conv = eigen->Solve();
+      {
+        std::complex<double> lambda = (num_conv > 0) ? eigen->GetEigenvalue(0) : 0.0;
+        Mpi::Print(" Found {:d} converged eigenvalue{}{}\n", num_conv,
+                   (num_conv > 1) ? "s" : "",
+                   (num_conv > 0) ? fmt::format(" (first = {:.3e}{:+.3e}i)",
+                                                lambda.real(), lambda.imag())
+                                  : "");
+      }
+
+      if (has_A2 && nonlinear_type == NonlinearEigenSolver::HYBRID)
+      {
+        Mpi::Print("\n Refining eigenvalues with Quasi-Newton solver\n");
+        if (contour)
+        {
+          SetShiftedOperators(sigma);
+        }
+        auto qn = std::make_unique<QuasiNewtonSolver>(
+            space_op.GetComm(), std::move(eigen), num_conv, iodata.problem.verbose,
+            iodata.solver.eigenmode.refine_nonlinear);
+        qn->SetTol(iodata.solver.eigenmode.tol);
+        qn->SetMaxIter(iodata.solver.eigenmode.max_it);
+        if (C)
+        {
+          qn->SetOperators(*K, *C, *M, EigenvalueSolver::ScaleType::NONE);
+        }
+        else
+        {
+          qn->SetOperators(*K, *M, EigenvalueSolver::ScaleType::NONE);
+        }
+        qn->SetExtraSystemMatrix(funcA2);
+        qn->SetPreconditionerUpdate(funcP);
+        qn->SetNumModes(nev, GetSubspaceSize(nev));
+        qn->SetPreconditionerLag(iodata.solver.eigenmode.preconditioner_lag,
+                                 iodata.solver.eigenmode.preconditioner_lag_tol);
+        qn->SetMaxRestart(iodata.solver.eigenmode.max_restart);
+        qn->SetLinearSolver(*ksp);
+        qn->SetShiftInvert(1i * sigma);
+        eigen = std::move(qn);
+
+        // Suppress wave port output during nonlinear eigensolver iterations.
+        space_op.GetWavePortOp().SetSuppressOutput(true);
+        num_conv = eigen->Solve();
+        space_op.GetWavePortOp().SetSuppressOutput(false);
+      }
+
+      // Check the coverage of the slice by the converged eigenvalues.
+      if (contour || s == n_slices - 1)
+      {
+        break;
+      }
+      double omega_max = sigma;
+      int num_below = 0;
+      for (int i = 0; i < num_conv; i++)
+      {
+        const double omega_r = GetFrequency(*eigen, i).real();
+        omega_max = std::max(omega_max, omega_r);
+        num_below += (omega_r < sigma_upper);
+      }
+      const bool covered =
+          (omega_max >= sigma_upper ||
+           static_cast<int>(modes.size()) + num_below >= iodata.solver.eigenmode.n);
+      if (covered || num_conv < nev || nev >= iodata.solver.eigenmode.n)
+      {
+        if (!covered)
+        {
+          Mpi::Warning("Converged eigenvalues only reach {:.3e} GHz in spectrum slice "
+                       "{:d}, eigenmodes up to {:.3e} GHz may be missing!\n",
+                       iodata.units.Dimensionalize<Units::ValueType::FREQUENCY>(omega_max),
+                       s + 1,
+                       iodata.units.Dimensionalize<Units::ValueType::FREQUENCY>(
+                           sigma_upper));
+        }
+        break;
+      }
+      nev = std::min(2 * nev, iodata.solver.eigenmode.n);
+      Mpi::Print("\n Converged eigenvalues do not cover the slice, increasing the number "
+                 "of modes to {:d}\n",
+                 nev);
+    }
+
+    // Keep the eigenpairs belonging to this slice. The first and last slices also keep
+    // any eigenvalues found below or above the search range, respectively.
+    if (KN)
+    {
+      eigen->SetBMat(*KN);
+      eigen->RescaleEigenvectors(num_conv);
+    }
+    int num_retained = 0;
+    for (int i = 0; i < num_conv; i++)
+    {
+      const std::complex<double> omega = GetFrequency(*eigen, i);
+      if ((s == 0 || omega.real() >= sigma) &&
+          (s == n_slices - 1 || omega.real() < sigma_upper))
+      {
+        auto &mode = modes.emplace_back();
+        mode.omega = omega;
+        mode.error_bkwd = eigen->GetError(i, EigenvalueSolver::ErrorType::BACKWARD);
+        mode.error_abs = eigen->GetError(i, EigenvalueSolver::ErrorType::ABSOLUTE);
+        mode.E.SetSize(space_op.GetNDSpace().GetTrueVSize());
+        mode.E.UseDevice(true);
+        eigen->GetEigenvector(i, mode.E);
+        num_retained++;
+      }
+    }
+    if (n_slices > 1)
+    {
+      Mpi::Print(" Retained {:d} eigenvalue{} in slice\n", num_retained,
+                 (num_retained != 1) ? "s" : "");
+    }
+  }
   SaveMetadata(*ksp);
+  return modes;
+}
 
-  // Calculate and record the error indicators, and postprocess the results.
-  Mpi::Print("\nComputing solution error estimates and performing postprocessing\n");
-  if (!KM)
+std::vector<EigenSolver::Eigenpair>
+EigenSolver::SolveSlicesInGroups(const std::vector<std::unique_ptr<Mesh>> &mesh,
+                                 FiniteElementSpace &nd_fespace, int n_groups) const
+{
+  // Split the processes into groups of contiguous ranks, where group h holds the ranks
+  // [a_h, a_{h + 1}). The group h solves the slices s = h, h + n_groups, ... on a copy of
+  // the finest mesh, and the elements of process p are placed on the group process with
+  // rank p n_h / P.
+  MPI_Comm comm = nd_fespace.GetComm();
+  const int size = Mpi::Size(comm), rank = Mpi::Rank(comm);
+  std::vector<int> group_roots(n_groups + 1);
+  for (int h = 0; h <= n_groups; h++)
   {
-    // Normalize the finalized eigenvectors with respect to mass matrix (unit electric field
-    // energy) even if they are not computed to be orthogonal with respect to it.
-    KM = space_op.GetInnerProductMatrix(0.0, 1.0, nullptr, M.get());
-    eigen->SetBMat(*KM);
-    eigen->RescaleEigenvectors(num_conv);
+    group_roots[h] = (h * size + n_groups - 1) / n_groups;
   }
-  Mpi::Print("\n");
-
-  for (int i = 0; i < num_conv; i++)
+  const int group = rank * n_groups / size;
+  const int n_h = group_roots[group + 1] - group_roots[group];
+  std::vector<int> part(size), ne(size);
+  for (int p = 0; p < size; p++)
   {
-    // Get the eigenvalue and relative error.
-    std::complex<double> omega = eigen->GetEigenvalue(i);
-    double error_bkwd = eigen->GetError(i, EigenvalueSolver::ErrorType::BACKWARD);
-    double error_abs = eigen->GetError(i, EigenvalueSolver::ErrorType::ABSOLUTE);
-    if (!C && !has_A2)
+    part[p] = p * n_h / size;
+  }
+  const int loc_ne = nd_fespace.GetParMesh().GetNE();
+  MPI_Allgather(&loc_ne, 1, MPI_INT, ne.data(), 1, MPI_INT, comm);
+  MPI_Comm group_comm;
+  MPI_Comm_split(comm, group, rank, &group_comm);
+  Mpi::Print("\nSolving {:d} spectrum slices on {:d} groups of processes\n",
+             iodata.solver.eigenmode.n_slices, n_groups);
+
+  std::vector<Eigenpair> modes;
+  {
+    // The group solve does not use the eigenvectors from a previous AMR iteration, and only
+    // uses the finest mesh without any coarser levels for geometric multigrid.
+    std::vector<std::unique_ptr<Mesh>> group_mesh;
+    group_mesh.push_back(std::make_unique<Mesh>(
+        mesh::DistributeMeshToGroup(mesh.back()->Get(), group_comm, part)));
+    SpaceOperator group_op(iodata, group_mesh);
+    std::vector<int> slices;
+    for (int s = group; s < iodata.solver.eigenmode.n_slices; s += n_groups)
     {
-      // Linear EVP has eigenvalue μ = -λ² = ω².
-      omega = std::sqrt(omega);
+      slices.push_back(s);
     }
-    else
+    auto group_modes = SolveSlices(group_op, slices, false);
+
+    // Gather the eigenvalues and errors from all groups, in order of the groups.
+    std::vector<int> num_modes(n_groups + 1, 0);
+    if (Mpi::Root(group_comm))
     {
-      // Quadratic EVP solves for eigenvalue λ = iω.
-      omega /= 1i;
+      num_modes[group + 1] = static_cast<int>(group_modes.size());
     }
-
-    // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for all postprocessing operations.
-    eigen->GetEigenvector(i, E);
-
-    linalg::NormalizePhase(space_op.GetComm(), E);
-
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    if (space_op.GetMaterialOp().HasWaveVector())
+    Mpi::GlobalSum(n_groups + 1, num_modes.data(), comm);
+    std::partial_sum(num_modes.begin(), num_modes.end(), num_modes.begin());
+    std::vector<double> data(4 * num_modes.back(), 0.0);
+    if (Mpi::Root(group_comm))
     {
-      // Calculate B field correction for Floquet BCs.
-      // B = -1/(iω) ∇ x E + 1/ω kp x E.
-      floquet_corr->AddMult(E, B, 1.0 / omega);
+      for (std::size_t i = 0; i < group_modes.size(); i++)
+      {
+        double *d = data.data() + 4 * (num_modes[group] + i);
+        d[0] = group_modes[i].omega.real();
+        d[1] = group_modes[i].omega.imag();
+        d[2] = group_modes[i].error_bkwd;
+        d[3] = group_modes[i].error_abs;
+      }
     }
-
-    auto total_domain_energy =
-        post_op.MeasureAndPrintAll(i, E, B, omega, error_abs, error_bkwd, num_conv);
-
-    // Calculate and record the error indicators.
-    if (i < iodata.solver.eigenmode.n)
+    Mpi::GlobalSum(static_cast<int>(data.size()), data.data(), comm);
+    modes.resize(num_modes.back());
+    for (std::size_t i = 0; i < modes.size(); i++)
     {
-      estimator.AddErrorIndicator(E, B, total_domain_energy, indicator);
+      modes[i].omega = {data[4 * i], data[4 * i + 1]};
+      modes[i].error_bkwd = data[4 * i + 2];
+      modes[i].error_abs = data[4 * i + 3];
     }
 
-    // Final write: Different condition than end of loop (i = num_conv - 1).
-    if (i == iodata.solver.eigenmode.n - 1)
+    // Copy the eigenvectors onto all processes, one at a time.
+    for (int h = 0; h < n_groups; h++)
     {
-      post_op.MeasureFinalize(indicator);
+      for (int i = num_modes[h]; i < num_modes[h + 1]; i++)
+      {
+        const bool owner = (group == h);
+        auto *group_x = owner ? &group_modes[i - num_modes[h]].E : nullptr;
+        TransferFromGroup(nd_fespace, owner ? &group_op.GetNDSpace() : nullptr,
+                          group_roots, ne, h, group_x, modes[i].E);
+        if (group_x)
+        {
+          group_x->Real().Destroy();
+          group_x->Imag().Destroy();
+        }
+      }
     }
   }
-  MFEM_VERIFY(num_conv >= iodata.solver.eigenmode.n, "Eigenmode solve only found "
-                                                         << num_conv << " modes when "
-                                                         << iodata.solver.eigenmode.n
-                                                         << " were requested!");
-  return {indicator, space_op.GlobalTrueVSize()};
+  MPI_Comm_free(&group_comm);
+  return modes;
 }
 
 }  // namespace palace
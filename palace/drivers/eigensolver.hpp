@@ -4,15 +4,19 @@
 #ifndef PALACE_DRIVERS_EIGEN_SOLVER_HPP
 #define PALACE_DRIVERS_EIGEN_SOLVER_HPP
 
+#include <complex>
 #include <memory>
 #include <vector>
 #include "drivers/basesolver.hpp"
+#include "linalg/vector.hpp"
 
 namespace palace
 {
 
 class ErrorIndicator;
+class FiniteElementSpace;
 class Mesh;
+class SpaceOperator;
 
 //
 // Driver class for eigenmode simulations.
@@ -20,6 +24,25 @@ class Mesh;
 class EigenSolver : public BaseSolver
 {
 private:
+  // Converged eigenpair retained from the solve for a spectrum slice.
+  struct Eigenpair
+  {
+    std::complex<double> omega;
+    double error_bkwd, error_abs;
+    ComplexVector E;
+  };
+
+  // Solves the eigenvalue problem for the given spectrum slices in turn, using the
+  // eigenvectors from the previous AMR iteration as a starting vector if warm_start is set.
+  std::vector<Eigenpair> SolveSlices(SpaceOperator &space_op,
+                                     const std::vector<int> &slices, bool warm_start) const;
+
+  // Solves the spectrum slices concurrently on groups of processes, and copies the
+  // retained eigenpairs from all groups onto all processes.
+  std::vector<Eigenpair> SolveSlicesInGroups(const std::vector<std::unique_ptr<Mesh>> &mesh,
+                                             FiniteElementSpace &nd_fespace,
+                                             int n_groups) const;
+
   std::pair<ErrorIndicator, long long int>
   Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const override;
 
@@ -42,37 +42,56 @@ ElectrostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   MFEM_VERIFY(n_step > 0, "No terminal boundaries specified for electrostatic simulation!");
 
   // Right-hand side term and solution vector storage.
-  Vector RHS(Grad.Width()), E(Grad.Height());
-  std::vector<Vector> V(n_step);
+  std::vector<Vector> RHS(n_step), V(n_step);
+  Vector E(Grad.Height());
 
   // Initialize structures for storing and reducing the results of error estimation.
   GradFluxErrorEstimator estimator(
       laplace_op.GetMaterialOp(), laplace_op.GetNDSpace(), laplace_op.GetRTSpaces(),
       iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
+      iodata.solver.linear.estimator_mg, iodata.solver.linear.estimator_initial_guess,
+      iodata.solver.linear.estimator_adaptive_tol);
   ErrorIndicator indicator;
 
-  // Main loop over terminal boundaries.
+  // Form the linear systems for a prescribed nonzero voltage on each terminal, and solve
+  // for all terminals together (sharing operator and preconditioner applications). The
+  // solutions from the previous AMR iteration are used as initial guesses when available,
+  // keeping the prescribed values on the Dirichlet boundaries.
   Mpi::Print("\nComputing electrostatic fields for {:d} terminal {}\n", n_step,
              (n_step > 1) ? "boundaries" : "boundary");
-  int step = 0;
   auto t0 = Timer::Now();
+  {
+    mfem::Array<const Vector *> X(n_step);
+    mfem::Array<Vector *> Y(n_step);
+    int step = 0;
+    for (const auto &[idx, data] : laplace_op.GetSources())
+    {
+      laplace_op.GetExcitationVector(idx, *K, V[step], RHS[step]);
+      if (step < NumWarmStart(laplace_op.GetH1Space()))
+      {
+        GetWarmStart(laplace_op.GetH1Space(), step, V[step],
+                     &laplace_op.GetDbcTDofLists().back());
+      }
+      X[step] = &RHS[step];
+      Y[step] = &V[step];
+      step++;
+    }
+    Mpi::Print("\n");
+    ksp.BlockMult(X, Y);
+  }
+
+  // Main loop over terminal boundaries for postprocessing.
+  int step = 0;
   for (const auto &[idx, data] : laplace_op.GetSources())
   {
     Mpi::Print("\nIt {:d}/{:d}: Index = {:d} (elapsed time = {:.2e} s)\n", step + 1, n_step,
                idx, Timer::Duration(Timer::Now() - t0).count());
 
-    // Form and solve the linear system for a prescribed nonzero voltage on the specified
-    // terminal.
-    Mpi::Print("\n");
-    laplace_op.GetExcitationVector(idx, *K, V[step], RHS);
-    ksp.Mult(RHS, V[step]);
-
     // Start Post-processing.
     BlockTimer bt2(Timer::POSTPRO);
     Mpi::Print(" Sol. ||V|| = {:.6e} (||RHS|| = {:.6e})\n",
                linalg::Norml2(laplace_op.GetComm(), V[step]),
-               linalg::Norml2(laplace_op.GetComm(), RHS));
+               linalg::Norml2(laplace_op.GetComm(), RHS[step]));
 
     // Compute E = -∇V on the true dofs.
     E = 0.0;
@@ -84,6 +103,7 @@ ElectrostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
     // Calculate and record the error indicators.
     Mpi::Print(" Updating solution error estimates\n");
     estimator.AddErrorIndicator(E, total_domain_energy, indicator);
+    SaveWarmStart(laplace_op.GetH1Space(), V[step], step);
 
     // Next terminal.
     step++;
@@ -3,6 +3,7 @@
 
 #include "magnetostaticsolver.hpp"
 
+#include <algorithm>
 #include <mfem.hpp>
 #include "fem/errorindicator.hpp"
 #include "fem/mesh.hpp"
@@ -41,70 +42,159 @@ MagnetostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   MFEM_VERIFY(n_step > 0,
               "No surface current boundaries specified for magnetostatic simulation!");
 
-  // Source term and solution vector storage.
-  Vector RHS(Curl.Width()), B(Curl.Height());
-  std::vector<Vector> A(n_step);
-  std::vector<double> I_inc(n_step);
+  // Source term and solution vector storage. The sources are solved together in blocks of
+  // at most max_block_size, so that the peak memory does not grow with the number of
+  // sources. The inductance matrix is accumulated as each solution is postprocessed, using
+  // the nonzero entries of the (boundary) right-hand sides which are kept for all sources.
+  constexpr int max_block_size = 8;
+  const int block_size = std::min(n_step, max_block_size);
+  std::vector<Vector> RHS(block_size), A(block_size);
+  std::vector<mfem::Array<int>> RHS_idx(n_step);
+  std::vector<Vector> RHS_val(n_step);
+  Vector B(Curl.Height());
+  std::vector<double> I_inc;
+  I_inc.reserve(n_step);
+  for (const auto &[idx, data] : curlcurl_op.GetSurfaceCurrentOp())
+  {
+    // Save excitation current for inductance matrix calculation.
+    I_inc.push_back(data.GetExcitationCurrent());
+  }
+  mfem::DenseMatrix M(n_step);
+  M = 0.0;
 
   // Initialize structures for storing and reducing the results of error estimation.
   CurlFluxErrorEstimator estimator(
       curlcurl_op.GetMaterialOp(), curlcurl_op.GetRTSpace(), curlcurl_op.GetNDSpaces(),
       iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
+      iodata.solver.linear.estimator_mg, iodata.solver.linear.estimator_initial_guess,
+      iodata.solver.linear.estimator_adaptive_tol);
   ErrorIndicator indicator;
 
-  // Main loop over current source boundaries.
+  // Form the linear systems for a prescribed current on each source, and solve for each
+  // block of sources together (sharing operator and preconditioner applications). The
+  // solutions from the previous AMR iteration are used as initial guesses when available.
   Mpi::Print("\nComputing magnetostatic fields for {:d} source {}\n", n_step,
              (n_step > 1) ? "boundaries" : "boundary");
+  const auto &surf_j_op = curlcurl_op.GetSurfaceCurrentOp();
+  auto it = surf_j_op.begin();
   int step = 0;
   auto t0 = Timer::Now();
-  for (const auto &[idx, data] : curlcurl_op.GetSurfaceCurrentOp())
+  while (step < n_step)
   {
-    Mpi::Print("\nIt {:d}/{:d}: Index = {:d} (elapsed time = {:.2e} s)\n", step + 1, n_step,
-               idx, Timer::Duration(Timer::Now() - t0).count());
-
-    // Form and solve the linear system for a prescribed current on the specified source.
-    Mpi::Print("\n");
-    A[step].SetSize(RHS.Size());
-    A[step].UseDevice(true);
-    A[step] = 0.0;
-    curlcurl_op.GetExcitationVector(idx, RHS);
-    ksp.Mult(RHS, A[step]);
-
-    // Start Post-processing.
-    BlockTimer bt2(Timer::POSTPRO);
-    Mpi::Print(" Sol. ||A|| = {:.6e} (||RHS|| = {:.6e})\n",
-               linalg::Norml2(curlcurl_op.GetComm(), A[step]),
-               linalg::Norml2(curlcurl_op.GetComm(), RHS));
-
-    // Compute B = ∇ x A on the true dofs.
-    Curl.Mult(A[step], B);
+    const int n_block = std::min(block_size, n_step - step);
+    std::vector<int> block_idx(n_block);
+    {
+      mfem::Array<const Vector *> X(n_block);
+      mfem::Array<Vector *> Y(n_block);
+      for (int k = 0; k < n_block; k++, ++it)
+      {
+        block_idx[k] = it->first;
+        curlcurl_op.GetExcitationVector(block_idx[k], RHS[k]);
+        A[k].SetSize(Curl.Width());
+        A[k].UseDevice(true);
+        A[k] = 0.0;
+        if (step + k < NumWarmStart(curlcurl_op.GetNDSpace()))
+        {
+          GetWarmStart(curlcurl_op.GetNDSpace(), step + k, A[k]);
+        }
+        X[k] = &RHS[k];
+        Y[k] = &A[k];
 
-    // Save excitation current for inductance matrix calculation.
-    I_inc[step] = data.GetExcitationCurrent();
+        // Keep the nonzero entries of the right-hand side for the inductance matrix.
+        const auto *h_RHS = RHS[k].HostRead();
+        RHS_idx[step + k].SetSize(0);
+        for (int d = 0; d < RHS[k].Size(); d++)
+        {
+          if (h_RHS[d] != 0.0)
+          {
+            RHS_idx[step + k].Append(d);
+          }
+        }
+        RHS_val[step + k].SetSize(RHS_idx[step + k].Size());
+        RHS[k].GetSubVector(RHS_idx[step + k], RHS_val[step + k]);
+      }
+      Mpi::Print("\n");
+      ksp.BlockMult(X, Y);
+    }
+
+    // Postprocessing for each source of the block.
+    for (int k = 0; k < n_block; k++, step++)
+    {
+      Mpi::Print("\nIt {:d}/{:d}: Index = {:d} (elapsed time = {:.2e} s)\n", step + 1,
+                 n_step, block_idx[k], Timer::Duration(Timer::Now() - t0).count());
+
+      // Start Post-processing.
+      BlockTimer bt2(Timer::POSTPRO);
+      Mpi::Print(" Sol. ||A|| = {:.6e} (||RHS|| = {:.6e})\n",
+                 linalg::Norml2(curlcurl_op.GetComm(), A[k]),
+                 linalg::Norml2(curlcurl_op.GetComm(), RHS[k]));
 
-    // Measurement and printing.
-    auto total_domain_energy = post_op.MeasureAndPrintAll(step, A[step], B, idx);
+      // Compute B = ∇ x A on the true dofs.
+      Curl.Mult(A[k], B);
 
-    // Calculate and record the error indicators.
-    Mpi::Print(" Updating solution error estimates\n");
-    estimator.AddErrorIndicator(B, total_domain_energy, indicator);
+      // Measurement and printing.
+      auto total_domain_energy = post_op.MeasureAndPrintAll(step, A[k], B, block_idx[k]);
 
-    // Next source.
-    step++;
+      // Calculate and record the error indicators.
+      Mpi::Print(" Updating solution error estimates\n");
+      estimator.AddErrorIndicator(B, total_domain_energy, indicator);
+
+      // Accumulate the inductance matrix entries coupling this source to all previous
+      // ones. See PostprocessTerminals.
+      AccumulateInductance(post_op, A[k], RHS_idx, RHS_val, I_inc, step, M);
+      SaveWarmStart(curlcurl_op.GetNDSpace(), A[k], step);
+    }
   }
 
   // Postprocess the inductance matrix from the computed field solutions.
   BlockTimer bt1(Timer::POSTPRO);
   SaveMetadata(ksp);
-  PostprocessTerminals(post_op, curlcurl_op.GetSurfaceCurrentOp(), A, I_inc);
+  PostprocessTerminals(post_op, curlcurl_op.GetSurfaceCurrentOp(), M, I_inc);
   post_op.MeasureFinalize(indicator);
   return {indicator, curlcurl_op.GlobalTrueVSize()};
 }
 
+void MagnetostaticSolver::AccumulateInductance(
+    PostOperator<ProblemType::MAGNETOSTATIC> &post_op, const Vector &A,
+    const std::vector<mfem::Array<int>> &RHS_idx, const std::vector<Vector> &RHS_val,
+    const std::vector<double> &I_inc, int i, mfem::DenseMatrix &M) const
+{
+  // Diagonal: Mᵢᵢ = 2 Uₘ(Aᵢ) / Iᵢ² = (Aᵢᵀ K Aᵢ) / Iᵢ²
+  auto &A_gf = post_op.GetAGridFunction().Real();
+  auto &H_gf = post_op.GetDomainPostOp().H;
+  A_gf.SetFromTrueDofs(A);
+  post_op.GetDomainPostOp().M_mag->Mult(A_gf, H_gf);
+  M(i, i) = linalg::Dot<Vector>(post_op.GetComm(), A_gf, H_gf) / (I_inc[i] * I_inc[i]);
+
+  // Off-diagonals: Mᵢⱼ = Uₘ(Aᵢ + Aⱼ) / (Iᵢ Iⱼ) - 1/2 (Iᵢ/Iⱼ Mᵢᵢ + Iⱼ/Iᵢ Mⱼⱼ)
+  //                    = (Aⱼᵀ K Aᵢ) / (Iᵢ Iⱼ) = (Aᵢᵀ RHSⱼ) / (Iᵢ Iⱼ)
+  // using K Aⱼ = RHSⱼ, so the solutions for j < i are not needed. The right-hand sides are
+  // only nonzero on the source boundaries, so the products only touch those entries and
+  // all of them are reduced together.
+  if (i == 0)
+  {
+    return;
+  }
+  std::vector<double> AtRHS(i, 0.0);
+  const auto *h_A = A.HostRead();
+  for (int j = 0; j < i; j++)
+  {
+    const auto *h_RHS = RHS_val[j].HostRead();
+    for (int d = 0; d < RHS_idx[j].Size(); d++)
+    {
+      AtRHS[j] += h_A[RHS_idx[j][d]] * h_RHS[d];
+    }
+  }
+  Mpi::GlobalSum(i, AtRHS.data(), post_op.GetComm());
+  for (int j = 0; j < i; j++)
+  {
+    M(i, j) = M(j, i) = AtRHS[j] / (I_inc[i] * I_inc[j]);
+  }
+}
+
 void MagnetostaticSolver::PostprocessTerminals(
     PostOperator<ProblemType::MAGNETOSTATIC> &post_op,
-    const SurfaceCurrentOperator &surf_j_op, const std::vector<Vector> &A,
+    const SurfaceCurrentOperator &surf_j_op, const mfem::DenseMatrix &M,
     const std::vector<double> &I_inc) const
 {
   // Postprocess the Maxwell inductance matrix. See p. 97 of the COMSOL AC/DC Module manual
@@ -113,34 +203,18 @@ void MagnetostaticSolver::PostprocessTerminals(
   // get M directly as:
   //                         Φ_i = ∫ B ⋅ n_j dS
   // and M_ij = Φ_i/I_j. The energy formulation avoids having to locally integrate B =
-  // ∇ x A.
-  mfem::DenseMatrix M(A.size()), Mm(A.size());
+  // ∇ x A. The entries of M are accumulated from the solutions in AccumulateInductance.
+  mfem::DenseMatrix Mm(M.Height());
   for (int i = 0; i < M.Height(); i++)
   {
-    // Diagonal: Mᵢᵢ = 2 Uₘ(Aᵢ) / Iᵢ² = (Aᵢᵀ K Aᵢ) / Iᵢ²
-    auto &A_gf = post_op.GetAGridFunction().Real();
-    auto &H_gf = post_op.GetDomainPostOp().H;
-    A_gf.SetFromTrueDofs(A[i]);
-    post_op.GetDomainPostOp().M_mag->Mult(A_gf, H_gf);
-    M(i, i) = Mm(i, i) =
-        linalg::Dot<Vector>(post_op.GetComm(), A_gf, H_gf) / (I_inc[i] * I_inc[i]);
-
-    // Off-diagonals: Mᵢⱼ = Uₘ(Aᵢ + Aⱼ) / (Iᵢ Iⱼ) - 1/2 (Iᵢ/Iⱼ Mᵢᵢ + Iⱼ/Iᵢ Mⱼⱼ)
-    //                    = (Aⱼᵀ K Aᵢ) / (Iᵢ Iⱼ)
-    for (int j = i + 1; j < M.Width(); j++)
-    {
-      A_gf.SetFromTrueDofs(A[j]);
-      M(i, j) = linalg::Dot<Vector>(post_op.GetComm(), A_gf, H_gf) / (I_inc[i] * I_inc[j]);
-      Mm(i, j) = -M(i, j);
-      Mm(i, i) -= Mm(i, j);
-    }
-
-    // Copy lower triangle from already computed upper triangle.
-    for (int j = 0; j < i; j++)
+    Mm(i, i) = M(i, i);
+    for (int j = 0; j < M.Width(); j++)
     {
-      M(i, j) = M(j, i);
-      Mm(i, j) = Mm(j, i);
-      Mm(i, i) -= Mm(i, j);
+      if (j != i)
+      {
+        Mm(i, j) = -M(i, j);
+        Mm(i, i) -= Mm(i, j);
+      }
     }
   }
   mfem::DenseMatrix Minv(M);
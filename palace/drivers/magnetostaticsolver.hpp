@@ -25,9 +25,15 @@ class SurfaceCurrentOperator;
 class MagnetostaticSolver : public BaseSolver
 {
 private:
+  void AccumulateInductance(PostOperator<ProblemType::MAGNETOSTATIC> &post_op,
+                            const Vector &A, const std::vector<mfem::Array<int>> &RHS_idx,
+                            const std::vector<Vector> &RHS_val,
+                            const std::vector<double> &I_inc, int i,
+                            mfem::DenseMatrix &M) const;
+
   void PostprocessTerminals(PostOperator<ProblemType::MAGNETOSTATIC> &post_op,
                             const SurfaceCurrentOperator &surf_j_op,
-                            const std::vector<Vector> &A,
+                            const mfem::DenseMatrix &M,
                             const std::vector<double> &I_inc) const;
 
   std::pair<ErrorIndicator, long long int>
@@ -3,6 +3,7 @@
 
 #include "transientsolver.hpp"
 
+#include <vector>
 #include <mfem.hpp>
 #include "fem/errorindicator.hpp"
 #include "fem/mesh.hpp"
@@ -37,20 +38,38 @@ TransientSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   SaveMetadata(space_op.GetNDSpaces());
 
   // Time stepping is uniform in the time domain. Index sets are for computing things like
-  // port voltages and currents in postprocessing.
+  // port voltages and currents in postprocessing. All excitations are integrated together
+  // as independent columns of the time integrator state, and share the postprocessing:
+  // measurements go to shared csv files and the fields of each excitation to a separate
+  // subfolder when there are several, as for the driven solver.
   PostOperator<ProblemType::TRANSIENT> post_op(iodata, space_op);
+  const auto &port_excitations = space_op.GetPortExcitations();
+  const int n_ex = time_op.NumExcitations();
+  std::vector<int> ex_idx;
+  for (const auto &[excitation_idx, excitation_spec] : port_excitations)
+  {
+    ex_idx.push_back(excitation_idx);
+  }
 
-  // Transient solver only supports a single excitation, this is check in SpaceOperator.
-  Mpi::Print("\nComputing transient response for:\n{}",
-             space_op.GetPortExcitations().FmtLog());
+  Mpi::Print("\nComputing transient response for:\n{}", port_excitations.FmtLog());
 
   // Initialize structures for storing and reducing the results of error estimation.
   TimeDependentFluxErrorEstimator<Vector> estimator(
       space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
       iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
+      iodata.solver.linear.estimator_mg, iodata.solver.linear.estimator_initial_guess,
+      iodata.solver.linear.estimator_adaptive_tol);
   ErrorIndicator indicator;
 
+  // Full measurements and error estimation can be performed at a reduced cadence. Error
+  // estimates are only computed within the given time window, and each is weighted by the
+  // number of time steps it represents.
+  const int delta_measure = iodata.solver.transient.delta_measure;
+  const int delta_estimate = iodata.solver.transient.delta_estimate;
+  const double estimator_min_t = iodata.solver.transient.estimator_min_t - 0.5 * delta_t;
+  const double estimator_max_t = iodata.solver.transient.estimator_max_t + 0.5 * delta_t;
+  int n_estimate = 0;
+
   // Main time integration loop.
   double t = -delta_t;
   auto t0 = Timer::Now();
@@ -73,24 +92,54 @@ TransientSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
       time_op.Step(t, delta_t);  // Advances t internally
     }
 
-    // Postprocess for the time step.
+    // Postprocess for the time step, for each excitation.
     BlockTimer bt2(Timer::POSTPRO);
-    const Vector &E = time_op.GetE();
-    const Vector &B = time_op.GetB();
-    Mpi::Print(" Sol. ||E|| = {:.6e}, ||B|| = {:.6e}\n",
-               linalg::Norml2(space_op.GetComm(), E),
-               linalg::Norml2(space_op.GetComm(), B));
+    const bool measure_all = (step % delta_measure == 0) || (step == n_step - 1);
+    bool estimate = false;
+    if (t >= estimator_min_t && t <= estimator_max_t)
+    {
+      n_estimate++;
+      estimate = (n_estimate == delta_estimate || step == n_step - 1 ||
+                  t + delta_t > estimator_max_t);
+    }
+    for (int c = 0; c < n_ex; c++)
+    {
+      const Vector &E = time_op.GetE(c);
+      const Vector &B = time_op.GetB(c);
+      if (n_ex > 1)
+      {
+        Mpi::Print(" Excitation {:d}:", ex_idx[c]);
+      }
+      Mpi::Print(" Sol. ||E|| = {:.6e}, ||B|| = {:.6e}\n",
+                 linalg::Norml2(space_op.GetComm(), E),
+                 linalg::Norml2(space_op.GetComm(), B));
 
-    auto total_domain_energy = post_op.MeasureAndPrintAll(step, E, B, t, J_coef(t));
+      auto total_domain_energy =
+          post_op.MeasureAndPrintAll(ex_idx[c], step, E, B, t, J_coef(t), measure_all);
 
-    // Calculate and record the error indicators.
-    Mpi::Print(" Updating solution error estimates\n");
-    estimator.AddErrorIndicator(E, B, total_domain_energy, indicator);
+      // Calculate and record the error indicators.
+      if (estimate)
+      {
+        if (!measure_all)
+        {
+          total_domain_energy = post_op.MeasureDomainFieldEnergyOnly(E, B);
+        }
+        Mpi::Print(" Updating solution error estimates\n");
+        estimator.AddErrorIndicator(E, B, total_domain_energy, indicator, n_estimate);
+      }
+    }
+    if (estimate)
+    {
+      n_estimate = 0;
+    }
   }
   // Final postprocessing & printing.
   BlockTimer bt1(Timer::POSTPRO);
   time_op.PrintStats();
-  SaveMetadata(time_op.GetLinearSolver());
+  if (time_op.HasLinearSolver())
+  {
+    SaveMetadata(time_op.GetLinearSolver());
+  }
   post_op.MeasureFinalize(indicator);
   return {indicator, space_op.GlobalTrueVSize()};
 }
@@ -115,6 +115,60 @@ std::unique_ptr<hypre::HypreCSRMatrix> BilinearForm::FullAssemble(const ceed::Op
 namespace
 {
 
+// MFEM's LOR discretization, exposing the signed permutation from the local dofs of the
+// LOR space to those of the high-order space (empty when the numbering is the same).
+class LORDiscretization : public mfem::ParLORDiscretization
+{
+public:
+  using mfem::ParLORDiscretization::ParLORDiscretization;
+
+  mfem::Array<int> GetLocalDofPermutation() const
+  {
+    mfem::Array<int> perm;
+    if (!HasSameDofNumbering())
+    {
+      ConstructLocalDofPermutation(perm);
+    }
+    return perm;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<hypre::HypreCSRMatrix>
+BilinearForm::FullAssembleLOR(const FiniteElementSpace &fespace, bool skip_zeros) const
+{
+  MFEM_VERIFY(&trial_fespace == &test_fespace,
+              "LOR assembly is only available for square operators!");
+  MFEM_VERIFY(!fespace.GetParMesh().Nonconforming(),
+              "LOR assembly is not supported for nonconforming meshes!");
+
+  // The LOR space copies the prolongation of the high-order space through the dof
+  // permutation, so their true dofs coincide. MFEM's LOR objects are only used to construct
+  // the refined mesh and the permutation, and the operator is assembled with libCEED on a
+  // Palace mesh and space with the same integrators. The refined mesh keeps the element and
+  // boundary attributes of its parents.
+  std::unique_ptr<mfem::FiniteElementCollection> lor_fec;
+  std::unique_ptr<Mesh> lor_mesh;
+  mfem::Array<int> perm;
+  {
+    LORDiscretization lor(const_cast<mfem::ParFiniteElementSpace &>(fespace.Get()));
+    lor_fec.reset(mfem::FiniteElementCollection::New(lor.GetParFESpace().FEColl()->Name()));
+    lor_mesh = std::make_unique<Mesh>(
+        std::make_unique<mfem::ParMesh>(*lor.GetParFESpace().GetParMesh()));
+    perm = lor.GetLocalDofPermutation();
+  }
+  FiniteElementSpace lor_fespace(*lor_mesh, lor_fec.get());
+  MFEM_VERIFY(lor_fespace.GetVSize() == fespace.GetVSize(),
+              "LOR space size mismatch with the high-order space!");
+  return ceed::CeedOperatorFullAssemble(*PartialAssemble(lor_fespace, lor_fespace),
+                                        skip_zeros, false,
+                                        (perm.Size() > 0) ? &perm : nullptr);
+}
+
+namespace
+{
+
 bool UseFullAssembly(const FiniteElementSpace &trial_fespace,
                      const FiniteElementSpace &test_fespace, int pa_order_threshold)
 {
@@ -152,7 +206,7 @@ std::unique_ptr<Operator> BilinearForm::Assemble(bool skip_zeros) const
 
 std::vector<std::unique_ptr<Operator>>
 BilinearForm::Assemble(const FiniteElementSpaceHierarchy &fespaces, bool skip_zeros,
-                       std::size_t l0) const
+                       std::size_t l0, bool lor) const
 {
   // Only available for square operators (same test and trial spaces).
   MFEM_VERIFY(&trial_fespace == &test_fespace &&
@@ -187,7 +241,11 @@ BilinearForm::Assemble(const FiniteElementSpaceHierarchy &fespaces, bool skip_ze
   ops.reserve(fespaces.GetNumLevels() - l0);
   for (std::size_t l = l0; l < fespaces.GetNumLevels(); l++)
   {
-    if (UseFullAssembly(fespaces.GetFESpaceAtLevel(l), pa_order_threshold))
+    if (lor && l == 0 && fespaces.GetFESpaceAtLevel(l).GetMaxElementOrder() > 1)
+    {
+      ops.push_back(FullAssembleLOR(fespaces.GetFESpaceAtLevel(l), skip_zeros));
+    }
+    else if (UseFullAssembly(fespaces.GetFESpaceAtLevel(l), pa_order_threshold))
     {
       ops.push_back(FullAssemble(*pa_ops[l - l0], skip_zeros));
     }
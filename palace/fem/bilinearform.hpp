@@ -83,11 +83,21 @@ public:
   static std::unique_ptr<hypre::HypreCSRMatrix> FullAssemble(const ceed::Operator &op,
                                                              bool skip_zeros, bool set);
 
+  // Assemble the operator on the low-order-refined (LOR) discretization of the given space
+  // as a sparse matrix. The rows and columns are numbered by the local dofs of the given
+  // (high-order) space, so that the matrix can be used in its place for preconditioning.
+  // Only available for square operators and conforming meshes.
+  std::unique_ptr<hypre::HypreCSRMatrix> FullAssembleLOR(const FiniteElementSpace &fespace,
+                                                         bool skip_zeros) const;
+
   std::unique_ptr<Operator> Assemble(bool skip_zeros) const;
 
+  // Assemble the operator on each level of the hierarchy. If lor is true, the coarsest
+  // level is assembled on its LOR discretization when its order is greater than one (this
+  // is only an approximation of the operator and is meant for preconditioning).
   std::vector<std::unique_ptr<Operator>>
-  Assemble(const FiniteElementSpaceHierarchy &fespaces, bool skip_zeros,
-           std::size_t l0 = 0) const;
+  Assemble(const FiniteElementSpaceHierarchy &fespaces, bool skip_zeros, std::size_t l0 = 0,
+           bool lor = false) const;
 };
 
 // Discrete linear operators map primal vectors to primal vectors for interpolation between
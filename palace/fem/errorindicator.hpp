@@ -23,18 +23,19 @@ protected:
   // refinement and coarsening.
   Vector local;
 
-  // Number of samples.
-  int n;
+  // Total weight of samples (the number of samples when all weights are unity).
+  double n;
 
 public:
-  ErrorIndicator(Vector &&local) : local(std::move(local)), n(1)
+  ErrorIndicator(Vector &&local) : local(std::move(local)), n(1.0)
   {
     this->local.UseDevice(true);
   }
-  ErrorIndicator() : n(0) { local.UseDevice(true); }
+  ErrorIndicator() : n(0.0) { local.UseDevice(true); }
 
-  // Add an indicator to the running total.
-  void AddIndicator(const Vector &indicator);
+  // Add an indicator to the running total, with an optional positive weight for the sample
+  // in the average (for example, the number of time steps it represents).
+  void AddIndicator(const Vector &indicator, double w = 1.0);
 
   // Return the local error indicator.
   const auto &Local() const { return local; }
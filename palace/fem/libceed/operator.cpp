@@ -147,7 +147,7 @@ namespace
 
 inline void CeedAddMult(const std::vector<CeedOperator> &op,
                         const std::vector<CeedVector> &u, const std::vector<CeedVector> &v,
-                        const Vector &x, Vector &y)
+                        const Vector *const *X, Vector *const *Y, int nblocks)
 {
   Ceed ceed;
   CeedMemType mem;
@@ -157,9 +157,16 @@ inline void CeedAddMult(const std::vector<CeedOperator> &op,
   {
     mem = CEED_MEM_HOST;
   }
-  const auto *x_data = x.Read(mem == CEED_MEM_DEVICE);
-  auto *y_data = y.ReadWrite(mem == CEED_MEM_DEVICE);
+  std::vector<const CeedScalar *> x_data(nblocks);
+  std::vector<CeedScalar *> y_data(nblocks);
+  for (int j = 0; j < nblocks; j++)
+  {
+    x_data[j] = X[j]->Read(mem == CEED_MEM_DEVICE);
+    y_data[j] = Y[j]->ReadWrite(mem == CEED_MEM_DEVICE);
+  }
 
+  // The loop over the block is inside the threaded region, so that each thread applies its
+  // sub-operators to all columns back-to-back.
   PalacePragmaOmp(parallel if (op.size() > 1))
   {
     const int id = utils::GetThreadNum();
@@ -167,16 +174,28 @@ inline void CeedAddMult(const std::vector<CeedOperator> &op,
                 "Out of bounds access for thread number " << id << "!");
     Ceed ceed;
     PalaceCeedCallBackend(CeedOperatorGetCeed(op[id], &ceed));
-    PalaceCeedCall(ceed, CeedVectorSetArray(u[id], mem, CEED_USE_POINTER,
-                                            const_cast<CeedScalar *>(x_data)));
-    PalaceCeedCall(ceed, CeedVectorSetArray(v[id], mem, CEED_USE_POINTER, y_data));
-    PalaceCeedCall(ceed,
-                   CeedOperatorApplyAdd(op[id], u[id], v[id], CEED_REQUEST_IMMEDIATE));
-    PalaceCeedCall(ceed, CeedVectorTakeArray(u[id], mem, nullptr));
-    PalaceCeedCall(ceed, CeedVectorTakeArray(v[id], mem, nullptr));
+    for (int j = 0; j < nblocks; j++)
+    {
+      PalaceCeedCall(ceed, CeedVectorSetArray(u[id], mem, CEED_USE_POINTER,
+                                              const_cast<CeedScalar *>(x_data[j])));
+      PalaceCeedCall(ceed, CeedVectorSetArray(v[id], mem, CEED_USE_POINTER, y_data[j]));
+      PalaceCeedCall(ceed,
+                     CeedOperatorApplyAdd(op[id], u[id], v[id], CEED_REQUEST_IMMEDIATE));
+      PalaceCeedCall(ceed, CeedVectorTakeArray(u[id], mem, nullptr));
+      PalaceCeedCall(ceed, CeedVectorTakeArray(v[id], mem, nullptr));
+    }
   }
 }
 
+inline void CeedAddMult(const std::vector<CeedOperator> &op,
+                        const std::vector<CeedVector> &u, const std::vector<CeedVector> &v,
+                        const Vector &x, Vector &y)
+{
+  const Vector *X = &x;
+  Vector *Y = &y;
+  CeedAddMult(op, u, v, &X, &Y, 1);
+}
+
 }  // namespace
 
 void Operator::Mult(const Vector &x, Vector &y) const
@@ -239,17 +258,78 @@ void Operator::AddMultTranspose(const Vector &x, Vector &y, const double a) cons
   }
 }
 
-namespace
+void Operator::ArrayMult(const mfem::Array<const Vector *> &X,
+                         mfem::Array<Vector *> &Y) const
 {
+  MFEM_ASSERT(X.Size() == Y.Size(),
+              "Incompatible block sizes for ceed::Operator::ArrayMult!");
+  for (int j = 0; j < Y.Size(); j++)
+  {
+    *Y[j] = 0.0;
+  }
+  CeedAddMult(op, u, v, X.GetData(), Y.GetData(), X.Size());
+  if (dof_multiplicity.Size() > 0)
+  {
+    for (int j = 0; j < Y.Size(); j++)
+    {
+      *Y[j] *= dof_multiplicity;
+    }
+  }
+}
 
-int CeedInternalCallocArray(size_t n, size_t unit, void *p)
+void Operator::ArrayAddMult(const mfem::Array<const Vector *> &X, mfem::Array<Vector *> &Y,
+                            const double a) const
 {
-  *(void **)p = calloc(n, unit);
-  MFEM_ASSERT(!n || !unit || *(void **)p,
-              "calloc failed to allocate " << n << " members of size " << unit << "!");
-  return 0;
+  MFEM_VERIFY(a == 1.0, "ceed::Operator::ArrayAddMult only supports coefficient = 1.0!");
+  MFEM_ASSERT(X.Size() == Y.Size(),
+              "Incompatible block sizes for ceed::Operator::ArrayAddMult!");
+  if (dof_multiplicity.Size() > 0)
+  {
+    // The scaled accumulation requires temporary storage for each column.
+    for (int j = 0; j < X.Size(); j++)
+    {
+      AddMult(*X[j], *Y[j], a);
+    }
+  }
+  else
+  {
+    CeedAddMult(op, u, v, X.GetData(), Y.GetData(), X.Size());
+  }
+}
+
+void Operator::ArrayMultTranspose(const mfem::Array<const Vector *> &X,
+                                  mfem::Array<Vector *> &Y) const
+{
+  for (int j = 0; j < Y.Size(); j++)
+  {
+    *Y[j] = 0.0;
+  }
+  ArrayAddMultTranspose(X, Y);
+}
+
+void Operator::ArrayAddMultTranspose(const mfem::Array<const Vector *> &X,
+                                     mfem::Array<Vector *> &Y, const double a) const
+{
+  MFEM_VERIFY(a == 1.0,
+              "ceed::Operator::ArrayAddMultTranspose only supports coefficient = 1.0!");
+  MFEM_ASSERT(X.Size() == Y.Size(),
+              "Incompatible block sizes for ceed::Operator::ArrayAddMultTranspose!");
+  if (dof_multiplicity.Size() > 0)
+  {
+    for (int j = 0; j < X.Size(); j++)
+    {
+      AddMultTranspose(*X[j], *Y[j], a);
+    }
+  }
+  else
+  {
+    CeedAddMult(op_t, v, u, X.GetData(), Y.GetData(), X.Size());
+  }
 }
 
+namespace
+{
+
 int CeedInternalFree(void *p)
 {
   free(*(void **)p);
@@ -257,11 +337,9 @@ int CeedInternalFree(void *p)
   return 0;
 }
 
-#define CeedInternalCalloc(n, p) CeedInternalCallocArray((n), sizeof(**(p)), p)
-
-void CeedOperatorAssembleCOO(Ceed ceed, CeedOperator op, bool skip_zeros, CeedSize *nnz,
-                             CeedInt **rows, CeedInt **cols, CeedVector *vals,
-                             CeedMemType *mem)
+void CeedOperatorAssembleCOO(Ceed ceed, CeedOperator op, bool skip_zeros, const int *perm,
+                             CeedSize *nnz, CeedInt **rows, CeedInt **cols,
+                             CeedVector *vals, CeedMemType *mem)
 {
   PalaceCeedCall(ceed, CeedGetPreferredMemType(ceed, mem));
 
@@ -272,48 +350,51 @@ void CeedOperatorAssembleCOO(Ceed ceed, CeedOperator op, bool skip_zeros, CeedSi
   PalaceCeedCall(ceed, CeedVectorCreate(ceed, *nnz, vals));
   PalaceCeedCall(ceed, CeedOperatorLinearAssemble(op, *vals));
 
-  // Filter out zero entries. For now, eliminating zeros happens all on the host.
+  // Filter out zero entries. For now, eliminating zeros happens all on the host. The
+  // entries are compacted in place, so no second copy of the COO arrays is allocated (the
+  // trailing entries of vals are simply ignored).
   // std::cout << "  Operator full assembly (COO) has " << *nnz << " NNZ";
   if (skip_zeros && *nnz > 0)
   {
     // XX TODO: Use Thrust for this (thrust::copy_if and thrust::zip_iterator)
-    CeedInt *new_rows, *new_cols;
-    PalaceCeedCall(ceed, CeedInternalCalloc(*nnz, &new_rows));
-    PalaceCeedCall(ceed, CeedInternalCalloc(*nnz, &new_cols));
-
-    CeedVector new_vals;
-    PalaceCeedCall(ceed, CeedVectorCreate(ceed, *nnz, &new_vals));
-
     CeedSize q = 0;
-    const CeedScalar *vals_array;
-    CeedScalar *new_vals_array;
-    PalaceCeedCall(ceed, CeedVectorGetArrayRead(*vals, CEED_MEM_HOST, &vals_array));
-    PalaceCeedCall(ceed, CeedVectorGetArrayWrite(new_vals, CEED_MEM_HOST, &new_vals_array));
+    CeedScalar *vals_array;
+    PalaceCeedCall(ceed, CeedVectorGetArray(*vals, CEED_MEM_HOST, &vals_array));
     for (CeedSize k = 0; k < *nnz; k++)
     {
       if (vals_array[k] != 0.0)
       {
-        new_rows[q] = (*rows)[k];
-        new_cols[q] = (*cols)[k];
-        new_vals_array[q] = vals_array[k];
+        (*rows)[q] = (*rows)[k];
+        (*cols)[q] = (*cols)[k];
+        vals_array[q] = vals_array[k];
         q++;
       }
     }
-    PalaceCeedCall(ceed, CeedVectorRestoreArrayRead(*vals, &vals_array));
-    PalaceCeedCall(ceed, CeedVectorRestoreArray(new_vals, &new_vals_array));
-
-    PalaceCeedCall(ceed, CeedInternalFree(rows));
-    PalaceCeedCall(ceed, CeedInternalFree(cols));
-    PalaceCeedCall(ceed, CeedVectorDestroy(vals));
-
+    PalaceCeedCall(ceed, CeedVectorRestoreArray(*vals, &vals_array));
     *nnz = q;
-    *rows = new_rows;
-    *cols = new_cols;
-    *vals = new_vals;
 
     // std::cout << " (new NNZ after removal: " << *nnz << ")";
   }
   // std::cout << "\n";
+
+  // Renumber the rows and columns with the signed dof permutation (also on the host),
+  // flipping the sign of the entries coupling dofs of opposite orientation.
+  if (perm && *nnz > 0)
+  {
+    CeedScalar *vals_array;
+    PalaceCeedCall(ceed, CeedVectorGetArray(*vals, CEED_MEM_HOST, &vals_array));
+    for (CeedSize k = 0; k < *nnz; k++)
+    {
+      const int i = perm[(*rows)[k]], j = perm[(*cols)[k]];
+      (*rows)[k] = (i >= 0) ? i : -1 - i;
+      (*cols)[k] = (j >= 0) ? j : -1 - j;
+      if ((i >= 0) != (j >= 0))
+      {
+        vals_array[k] = -vals_array[k];
+      }
+    }
+    PalaceCeedCall(ceed, CeedVectorRestoreArray(*vals, &vals_array));
+  }
 }
 
 std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSR(Ceed ceed, CeedInt m, CeedInt n,
@@ -324,39 +405,53 @@ std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSR(Ceed ceed, CeedInt m, Ce
   // Preallocate CSR memory on host (like PETSc's MatSetValuesCOO). Check for overflow for
   // large nonzero counts.
   const int nnz_int = mfem::internal::to_int(nnz);
-  mfem::Array<int> I(m + 1), J(nnz_int), perm(nnz_int), Jmap(nnz_int + 1);
-  I = 0;
-  for (int k = 0; k < nnz_int; k++)
+  mfem::Array<int> I(m + 1), perm(nnz_int);
+
+  // Bucket the COO entries by row with a counting sort, after which the row indices are no
+  // longer needed and are released before any of the CSR arrays are allocated.
   {
-    perm[k] = k;
+    mfem::Array<int> offsets(m + 1);
+    offsets = 0;
+    for (int k = 0; k < nnz_int; k++)
+    {
+      offsets[rows[k] + 1]++;
+    }
+    for (int i = 0; i < m; i++)
+    {
+      offsets[i + 1] += offsets[i];
+    }
+    I = offsets;
+    for (int k = 0; k < nnz_int; k++)
+    {
+      perm[offsets[rows[k]]++] = k;
+    }
   }
-  std::sort(perm.begin(), perm.end(),
-            [&](const int &i, const int &j) { return (rows[i] < rows[j]); });
+  PalaceCeedCall(ceed, CeedInternalFree(&rows));
 
+  // Sort the column entries in each row and count the unique nonzeros, compressing the row
+  // pointers in place.
+  mfem::Array<int> J(nnz_int), Jmap(nnz_int + 1);
   int q = -1;  // True nnz index
-  for (int k = 0; k < nnz_int;)
+  for (int i = 0; i < m; i++)
   {
-    // Sort column entries in the row.
-    const int row = rows[perm[k]];
-    const int start = k;
-    while (k < nnz_int && rows[perm[k]] == row)
+    const int start = I[i], end = I[i + 1];
+    I[i] = q + 1;
+    if (start == end)
     {
-      k++;
+      continue;
     }
-    std::sort(perm.begin() + start, perm.begin() + k,
-              [&](const int &i, const int &j) { return (cols[i] < cols[j]); });
+    std::sort(perm.begin() + start, perm.begin() + end,
+              [&](const int &a, const int &b) { return (cols[a] < cols[b]); });
 
     q++;
-    I[row + 1] = 1;
     J[q] = cols[perm[start]];
     Jmap[q + 1] = 1;
-    for (int p = start + 1; p < k; p++)
+    for (int p = start + 1; p < end; p++)
     {
       if (cols[perm[p]] != cols[perm[p - 1]])
       {
         // New nonzero.
         q++;
-        I[row + 1]++;
         J[q] = cols[perm[p]];
         Jmap[q + 1] = 1;
       }
@@ -366,16 +461,11 @@ std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSR(Ceed ceed, CeedInt m, Ce
       }
     }
   }
-  PalaceCeedCall(ceed, CeedInternalFree(&rows));
   PalaceCeedCall(ceed, CeedInternalFree(&cols));
 
   // Finalize I, Jmap.
   const int nnz_new = q + 1;
-  I[0] = 0;
-  for (int i = 0; i < m; i++)
-  {
-    I[i + 1] += I[i];
-  }
+  I[m] = nnz_new;
   Jmap[0] = 0;
   for (int k = 0; k < nnz_new; k++)
   {
@@ -452,9 +542,14 @@ std::unique_ptr<hypre::HypreCSRMatrix> OperatorCOOtoCSR(Ceed ceed, CeedInt m, Ce
 
 }  // namespace
 
-std::unique_ptr<hypre::HypreCSRMatrix> CeedOperatorFullAssemble(const Operator &op,
-                                                                bool skip_zeros, bool set)
+std::unique_ptr<hypre::HypreCSRMatrix>
+CeedOperatorFullAssemble(const Operator &op, bool skip_zeros, bool set,
+                         const mfem::Array<int> *perm)
 {
+  MFEM_VERIFY(!perm || (perm->Size() == op.Height() && perm->Size() == op.Width()),
+              "Dof permutation for full assembly must match the operator size!");
+  const int *h_perm = perm ? perm->HostRead() : nullptr;
+
   // Assemble operators on each thread.
   std::vector<std::unique_ptr<hypre::HypreCSRMatrix>> loc_mat(op.Size());
   PalacePragmaOmp(parallel if (op.Size() > 1))
@@ -475,12 +570,14 @@ std::unique_ptr<hypre::HypreCSRMatrix> CeedOperatorFullAssemble(const Operator &
     else
     {
       // First, get matrix on master thread in COO format, with rows/cols always on host
-      // and vals potentially on the device. Process skipping zeros if desired.
+      // and vals potentially on the device. Process skipping zeros and renumbering if
+      // desired.
       CeedSize nnz;
       CeedInt *rows, *cols;
       CeedVector vals;
       CeedMemType mem;
-      CeedOperatorAssembleCOO(ceed, op[id], skip_zeros, &nnz, &rows, &cols, &vals, &mem);
+      CeedOperatorAssembleCOO(ceed, op[id], skip_zeros, h_perm, &nnz, &rows, &cols, &vals,
+                              &mem);
       PalaceCeedCall(ceed, CeedOperatorAssemblyDataStrip(op[id]));
 
       // Convert COO to CSR (on each thread). The COO memory is free'd internally.
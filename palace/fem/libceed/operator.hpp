@@ -62,6 +62,21 @@ public:
   void MultTranspose(const Vector &x, Vector &y) const override;
 
   void AddMultTranspose(const Vector &x, Vector &y, const double a = 1.0) const override;
+
+  // Multiple-vector operator application: all columns are applied within the same threaded
+  // region so each thread's element data (restriction offsets, quadrature data) is reused
+  // across the block while it is still in cache.
+  void ArrayMult(const mfem::Array<const Vector *> &X,
+                 mfem::Array<Vector *> &Y) const override;
+
+  void ArrayAddMult(const mfem::Array<const Vector *> &X, mfem::Array<Vector *> &Y,
+                    const double a = 1.0) const override;
+
+  void ArrayMultTranspose(const mfem::Array<const Vector *> &X,
+                          mfem::Array<Vector *> &Y) const override;
+
+  void ArrayAddMultTranspose(const mfem::Array<const Vector *> &X, mfem::Array<Vector *> &Y,
+                             const double a = 1.0) const override;
 };
 
 // A symmetric ceed::Operator replaces *MultTranspose with *Mult (by default, libCEED
@@ -76,11 +91,24 @@ public:
   {
     AddMult(x, y, a);
   }
+  void ArrayMultTranspose(const mfem::Array<const Vector *> &X,
+                          mfem::Array<Vector *> &Y) const override
+  {
+    ArrayMult(X, Y);
+  }
+  void ArrayAddMultTranspose(const mfem::Array<const Vector *> &X, mfem::Array<Vector *> &Y,
+                             double a = 1.0) const override
+  {
+    ArrayAddMult(X, Y, a);
+  }
 };
 
-// Assemble a ceed::Operator as a CSR matrix.
-std::unique_ptr<hypre::HypreCSRMatrix> CeedOperatorFullAssemble(const Operator &op,
-                                                                bool skip_zeros, bool set);
+// Assemble a ceed::Operator as a CSR matrix. If a signed permutation of the local dofs is
+// given (entry -1 - i for dof i with opposite orientation, as for MFEM's signed dofs),
+// the rows and columns of the assembled matrix are renumbered with it.
+std::unique_ptr<hypre::HypreCSRMatrix>
+CeedOperatorFullAssemble(const Operator &op, bool skip_zeros, bool set,
+                         const mfem::Array<int> *perm = nullptr);
 
 // Construct a coarse-level ceed::Operator, reusing the quadrature data and quadrature
 // function from the fine-level operator. Only available for square, symmetric operators
@@ -0,0 +1,401 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "beyn.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <Eigen/Eigenvalues>
+#include <Eigen/SVD>
+#include <mfem.hpp>
+#include "linalg/divfree.hpp"
+#include "linalg/orthog.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+using namespace std::complex_literals;
+
+BeynSolver::BeynSolver(MPI_Comm comm, int print) : comm(comm), print(print)
+{
+  nev = ncv = 0;
+  rtol = 0.0;
+  max_it = 0;
+  center = 0.0;
+  rx = ry = 0.0;
+  num_points = 0;
+  opK = opC = opM = nullptr;
+  normK = normC = normM = 0.0;
+  opInv = nullptr;
+  opProj = nullptr;
+  opB = nullptr;
+}
+
+void BeynSolver::SetOperators(const ComplexOperator &K, const ComplexOperator &M,
+                              EigenvalueSolver::ScaleType type)
+{
+  MFEM_VERIFY(!opK || K.Height() == opK->Height(),
+              "Invalid modification of eigenvalue problem size!");
+  opK = &K;
+  opC = nullptr;
+  opM = &M;
+  r.SetSize(opK->Height());
+  r.UseDevice(true);
+}
+
+void BeynSolver::SetOperators(const ComplexOperator &K, const ComplexOperator &C,
+                              const ComplexOperator &M, EigenvalueSolver::ScaleType type)
+{
+  MFEM_VERIFY(!opK || K.Height() == opK->Height(),
+              "Invalid modification of eigenvalue problem size!");
+  opK = &K;
+  opC = &C;
+  opM = &M;
+  r.SetSize(opK->Height());
+  r.UseDevice(true);
+}
+
+void BeynSolver::SetNumModes(int num_eig, int num_vec)
+{
+  nev = num_eig;
+  ncv = (num_vec > 0) ? num_vec : std::max(2 * nev, nev + 8);
+}
+
+void BeynSolver::SetContour(std::complex<double> c, double r_x, double r_y, int n)
+{
+  MFEM_VERIFY(r_x > 0.0 && r_y > 0.0 && n > 0,
+              "Invalid contour for contour-integral eigenvalue solver!");
+  center = c;
+  rx = r_x;
+  ry = r_y;
+  num_points = n;
+}
+
+bool BeynSolver::InsideContour(std::complex<double> l) const
+{
+  const double x = (l.real() - center.real()) / rx, y = (l.imag() - center.imag()) / ry;
+  return (x * x + y * y < 1.0);
+}
+
+int BeynSolver::Solve()
+{
+  MFEM_VERIFY(opK && opM, "Operators are not set for contour-integral eigenvalue solver!");
+  MFEM_VERIFY(nev > 0, "Number of requested modes is not positive!");
+  MFEM_VERIFY(rtol > 0.0, "Eigensolver tolerance is not positive!");
+  MFEM_VERIFY(num_points > 0,
+              "No contour provided for contour-integral eigenvalue solver!");
+  MFEM_VERIFY(opInv && funcA && funcP,
+              "No linear solver or system matrix update provided for contour-integral "
+              "eigenvalue solver!");
+  const int n = opK->Height();
+  const int max_iter = (max_it > 0) ? max_it : 3;
+  int m = ncv;
+  const int max_m = 4 * ncv;
+
+  // Initialize the probe block with random vectors (and the initial vector, if provided).
+  // The block may grow during the iterations, so new vectors are appended.
+  std::vector<ComplexVector> V, A0, A1;
+  auto ResizeBlock = [&](int size)
+  {
+    for (int j = static_cast<int>(V.size()); j < size; j++)
+    {
+      V.emplace_back(n);
+      A0.emplace_back(n);
+      A1.emplace_back(n);
+      V[j].UseDevice(true);
+      A0[j].UseDevice(true);
+      A1[j].UseDevice(true);
+      if (j == 0 && v0.Size() == n)
+      {
+        V[j] = v0;
+      }
+      else
+      {
+        linalg::SetRandom(comm, V[j], j + 1);
+        if (opProj)
+        {
+          opProj->Mult(V[j]);
+        }
+      }
+    }
+  };
+  ResizeBlock(m);
+  ComplexVector y(n);
+  y.UseDevice(true);
+
+  // The system matrix and preconditioner matrix for each quadrature node are assembled on
+  // the first iteration only. The linear solver is shared by all nodes, so its
+  // preconditioner is still set up again at each node.
+  opA.clear();
+  opP.clear();
+  opA.resize(num_points);
+  opP.resize(num_points);
+
+  int num_conv = 0;
+  for (int it = 0; it < max_iter; it++)
+  {
+    // Compute the moments A₀ = 1/(2πi) ∮ P(λ)⁻¹ V dλ and A₁ = 1/(2πi) ∮ λ P(λ)⁻¹ V dλ using
+    // the trapezoidal rule. The nodes are offset by half a step so that none lie on the
+    // axes of the ellipse.
+    for (int j = 0; j < m; j++)
+    {
+      A0[j] = 0.0;
+      A1[j] = 0.0;
+    }
+    for (int k = 0; k < num_points; k++)
+    {
+      const double theta = 2.0 * M_PI * (k + 0.5) / num_points;
+      const std::complex<double> z = center + rx * std::cos(theta) +
+                                     1i * ry * std::sin(theta),
+                                 dz = -rx * std::sin(theta) + 1i * ry * std::cos(theta),
+                                 w = dz / (1i * static_cast<double>(num_points));
+      if (print > 0)
+      {
+        Mpi::Print(comm, " Contour node {:d}/{:d}: λ = {:.3e}{:+.3e}i\n", k + 1, num_points,
+                   z.real(), z.imag());
+      }
+      if (!opA[k])
+      {
+        opA[k] = funcA(z);
+        opP[k] = funcP(1.0, z, z * z, z.imag());
+      }
+      opInv->SetOperators(*opA[k], *opP[k]);
+      for (int j = 0; j < m; j++)
+      {
+        opInv->Mult(V[j], y);
+        if (opProj)
+        {
+          opProj->Mult(y);
+        }
+        A0[j].Add(w, y);
+        A1[j].Add(w * z, y);
+      }
+    }
+
+    // Compute a thin QR decomposition A₀ = Q R (Q overwrites A₀) and the SVD of R to
+    // determine the numerical rank of A₀ and its singular vectors.
+    Eigen::MatrixXcd R = Eigen::MatrixXcd::Zero(m, m);
+    for (int j = 0; j < m; j++)
+    {
+      linalg::OrthogonalizeColumnCGS(comm, A0, A0[j], R.col(j).data(), j, true);
+      R(j, j) = linalg::Norml2(comm, A0[j]);
+      if (std::abs(R(j, j)) > 0.0)
+      {
+        A0[j] *= 1.0 / R(j, j);
+      }
+    }
+    // For Eigen = v3.4.0 (latest tagged release as of 10/2023)
+    Eigen::JacobiSVD<Eigen::MatrixXcd> svd;
+    svd.compute(R, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    const auto &sigma = svd.singularValues();
+    int rank = 0;
+    while (rank < m && sigma[rank] > 1.0e-2 * rtol * sigma[0])
+    {
+      rank++;
+    }
+    if (rank == 0)
+    {
+      // No eigenvalues inside of the contour.
+      eig.clear();
+      X.clear();
+      res.clear();
+      xscale.clear();
+      num_conv = 0;
+      break;
+    }
+    if (rank == m && m < max_m)
+    {
+      // The contour may enclose more eigenvalues than the probe block can resolve, so
+      // enlarge the block and repeat the contour integration with the original probe
+      // vectors and the new ones (this does not count as an iteration).
+      m = std::min(2 * m, max_m);
+      if (print > 0)
+      {
+        Mpi::Print(comm,
+                   " Contour moment matrix has full rank, increasing probe block size to "
+                   "{:d}\n",
+                   m);
+      }
+      ResizeBlock(m);
+      it--;
+      continue;
+    }
+    if (rank == m)
+    {
+      Mpi::Warning(comm,
+                   "Contour-integral eigenvalue solver moment matrix has full rank, the "
+                   "number of eigenvalues inside the contour may exceed the probe block "
+                   "size {:d}!\n",
+                   m);
+    }
+
+    // Form the projected matrix B = U₀ᴴ A₁ W₀ Σ₀⁻¹ with A₀ = U₀ Σ₀ W₀ᴴ and U₀ = Q U, and
+    // compute its eigenvalues.
+    Eigen::MatrixXcd QA1(m, m);
+    for (int j = 0; j < m; j++)
+    {
+      for (int i = 0; i < m; i++)
+      {
+        QA1(i, j) = A1[j] * A0[i];  // Local inner product
+      }
+    }
+    Mpi::GlobalSum(m * m, QA1.data(), comm);
+    const Eigen::MatrixXcd U = svd.matrixU().leftCols(rank);
+    const Eigen::MatrixXcd B = U.adjoint() * QA1 * svd.matrixV().leftCols(rank) *
+                               sigma.head(rank)
+                                   .cwiseInverse()
+                                   .cast<std::complex<double>>()
+                                   .asDiagonal();
+    Eigen::ComplexEigenSolver<Eigen::MatrixXcd> ces;
+    ces.compute(B);
+    const Eigen::MatrixXcd S = U * ces.eigenvectors();
+
+    // Compute the Ritz vectors and residuals for the eigenvalues inside of the contour.
+    std::vector<std::complex<double>> eig_it;
+    std::vector<ComplexVector> X_it;
+    std::vector<double> res_it;
+    std::vector<bool> conv_it;
+    for (int i = 0; i < rank; i++)
+    {
+      const std::complex<double> l = ces.eigenvalues()(i);
+      if (!InsideContour(l))
+      {
+        continue;
+      }
+      ComplexVector &x = X_it.emplace_back(n);
+      x.UseDevice(true);
+      x = 0.0;
+      for (int j = 0; j < m; j++)
+      {
+        x.Add(S(j, i), A0[j]);
+      }
+      x *= 1.0 / linalg::Norml2(comm, x);
+      eig_it.push_back(l);
+      res_it.push_back(GetResidualNorm(l, x, r));
+      conv_it.push_back(res_it.back() / GetBackwardScaling(l) < rtol);
+    }
+    const int num_inside = static_cast<int>(eig_it.size());
+    num_conv = static_cast<int>(std::count(conv_it.begin(), conv_it.end(), true));
+    if (print > 0)
+    {
+      Mpi::Print(comm,
+                 " Contour iteration {:d}: rank = {:d}, {:d} eigenvalue{} inside contour, "
+                 "{:d} converged\n",
+                 it + 1, rank, num_inside, (num_inside != 1) ? "s" : "", num_conv);
+    }
+
+    // Store the eigenpairs, converged ones first and each group sorted by increasing
+    // imaginary part.
+    std::vector<int> perm(num_inside);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::stable_sort(perm.begin(), perm.end(),
+                     [&](int i, int j)
+                     {
+                       if (conv_it[i] != conv_it[j])
+                       {
+                         return static_cast<bool>(conv_it[i]);
+                       }
+                       return eig_it[i].imag() < eig_it[j].imag();
+                     });
+    eig.clear();
+    X.clear();
+    res.clear();
+    for (auto i : perm)
+    {
+      eig.push_back(eig_it[i]);
+      X.push_back(std::move(X_it[i]));
+      res.push_back(res_it[i]);
+    }
+    xscale.assign(num_inside, 0.0);
+    if (num_conv == num_inside && num_conv > 0)
+    {
+      break;
+    }
+
+    // Use the filtered subspace as the probe block for the next iteration.
+    std::swap(V, A0);
+  }
+  return num_conv;
+}
+
+double BeynSolver::GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                                   ComplexVector &r) const
+{
+  // Compute the i-th eigenpair residual: || P(λ) x ||₂ = || (K + λ C + λ² M) x ||₂ for
+  // eigenvalue λ.
+  opK->Mult(x, r);
+  if (opC)
+  {
+    opC->AddMult(x, r, l);
+  }
+  opM->AddMult(x, r, l * l);
+  return linalg::Norml2(comm, r);
+}
+
+double BeynSolver::GetBackwardScaling(std::complex<double> l) const
+{
+  if (normK <= 0.0)
+  {
+    normK = linalg::SpectralNorm(comm, *opK, opK->IsReal());
+  }
+  if (normC <= 0.0 && opC)
+  {
+    normC = linalg::SpectralNorm(comm, *opC, opC->IsReal());
+  }
+  if (normM <= 0.0)
+  {
+    normM = linalg::SpectralNorm(comm, *opM, opM->IsReal());
+  }
+  double t = std::abs(l);
+  return normK + t * normC + t * t * normM;
+}
+
+std::complex<double> BeynSolver::GetEigenvalue(int i) const
+{
+  MFEM_VERIFY(i >= 0 && i < static_cast<int>(eig.size()),
+              "Out of range eigenpair requested (i = " << i << ", n = " << eig.size()
+                                                       << ")!");
+  return eig[i];
+}
+
+void BeynSolver::GetEigenvector(int i, ComplexVector &x) const
+{
+  MFEM_VERIFY(i >= 0 && i < static_cast<int>(eig.size()),
+              "Out of range eigenpair requested (i = " << i << ", n = " << eig.size()
+                                                       << ")!");
+  MFEM_VERIFY(x.Size() == X[i].Size(), "Invalid size mismatch for provided eigenvector!");
+  x = X[i];
+  if (xscale[i] > 0.0)
+  {
+    x *= xscale[i];
+  }
+}
+
+double BeynSolver::GetError(int i, EigenvalueSolver::ErrorType type) const
+{
+  MFEM_VERIFY(i >= 0 && i < static_cast<int>(eig.size()),
+              "Out of range eigenpair requested (i = " << i << ", n = " << eig.size()
+                                                       << ")!");
+  switch (type)
+  {
+    case ErrorType::ABSOLUTE:
+      return res[i];
+    case ErrorType::RELATIVE:
+      return res[i] / std::abs(eig[i]);
+    case ErrorType::BACKWARD:
+      return res[i] / GetBackwardScaling(eig[i]);
+  }
+  return 0.0;
+}
+
+void BeynSolver::RescaleEigenvectors(int num_eig)
+{
+  for (int i = 0; i < std::min(num_eig, static_cast<int>(X.size())); i++)
+  {
+    xscale[i] = 1.0 / (opB ? linalg::Norml2(comm, X[i], *opB, r) : 1.0);
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,187 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_BEYN_HPP
+#define PALACE_LINALG_BEYN_HPP
+
+#include <complex>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <mpi.h>
+#include "linalg/eps.hpp"
+#include "linalg/ksp.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+//
+// Contour-integral eigenvalue solver based on Beyn's method (W.-J. Beyn, Linear Algebra
+// Appl. 2012) for computing all eigenvalues of the quadratic eigenvalue problem
+// P(λ) x = (K + λ C + λ² M) x = 0 (C may be zero) enclosed by an elliptical contour in the
+// complex plane. The first two moments of P(λ)⁻¹ applied to a block of probe vectors are
+// approximated with the trapezoidal rule, which requires the solution of independent
+// shifted linear systems at each quadrature node, and the eigenpairs are extracted with a
+// Rayleigh-Ritz step on the small projected problem. Optionally, the probe block is
+// replaced by the filtered subspace and the procedure repeated, similar to FEAST.
+//
+class BeynSolver : public EigenvalueSolver
+{
+public:
+  using SystemMatrixFunction =
+      std::function<std::unique_ptr<ComplexOperator>(std::complex<double>)>;
+  using PreconditionerFunction = std::function<std::unique_ptr<ComplexOperator>(
+      std::complex<double>, std::complex<double>, std::complex<double>, double)>;
+
+private:
+  // MPI communicator.
+  MPI_Comm comm;
+
+  // Control print level for debugging.
+  int print;
+
+  // Number of eigenvalues to be computed and size of the probe block.
+  int nev, ncv;
+
+  // Relative eigenvalue error convergence tolerance for the solver.
+  double rtol;
+
+  // Maximum number of contour integration (subspace) iterations.
+  int max_it;
+
+  // Elliptical contour λ(θ) = c + rx cos(θ) + i ry sin(θ), discretized with the given
+  // number of quadrature nodes.
+  std::complex<double> center;
+  double rx, ry;
+  int num_points;
+
+  // References to matrices defining the eigenvalue problem (not owned). opC may be nullptr.
+  const ComplexOperator *opK, *opC, *opM;
+
+  // Operator norms for computing the backward error.
+  mutable double normK, normC, normM;
+
+  // Functions for assembling the system matrix P(λ) and the matrix used to construct the
+  // preconditioner at each quadrature node, and storage for the ones of every node, which
+  // are assembled once and reused for all contour integration iterations.
+  SystemMatrixFunction funcA;
+  PreconditionerFunction funcP;
+  std::vector<std::unique_ptr<ComplexOperator>> opA, opP;
+
+  // Reference to linear solver used for computing the action of P(λ)⁻¹ (not owned).
+  ComplexKspSolver *opInv;
+
+  // Reference to solver for projecting an intermediate vector onto a divergence-free space
+  // (not owned).
+  const DivFreeSolver<ComplexVector> *opProj;
+
+  // Reference to matrix used for weighted inner products (not owned). May be nullptr, in
+  // which case identity is used.
+  const Operator *opB;
+
+  // Optional initial vector for the probe block.
+  ComplexVector v0;
+
+  // Storage for computed eigenvalues, eigenvectors (with unit ℓ² norm), residual norms, and
+  // eigenvector scalings. Converged eigenpairs are stored first, sorted by increasing
+  // imaginary part.
+  std::vector<std::complex<double>> eig;
+  std::vector<ComplexVector> X;
+  std::vector<double> res, xscale;
+
+  // Workspace vector for operator applications.
+  mutable ComplexVector r;
+
+  // Helper routine for computing the eigenpair residual: || P(λ) x ||₂.
+  double GetResidualNorm(std::complex<double> l, const ComplexVector &x,
+                         ComplexVector &r) const;
+
+  // Helper routine for computing the backward error.
+  double GetBackwardScaling(std::complex<double> l) const;
+
+  // Returns true if the given eigenvalue lies inside of the contour.
+  bool InsideContour(std::complex<double> l) const;
+
+public:
+  BeynSolver(MPI_Comm comm, int print);
+
+  // Set operators for the generalized eigenvalue problem K x = -λ² M x or the quadratic
+  // eigenvalue problem. The computed eigenvalues are always λ. No scaling is performed.
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &M,
+                    ScaleType type) override;
+  void SetOperators(const ComplexOperator &K, const ComplexOperator &C,
+                    const ComplexOperator &M, ScaleType type) override;
+
+  // Set the function for assembling the system matrix P(λ) = K + λ C + λ² M at a given
+  // quadrature node.
+  void SetSystemMatrixUpdate(SystemMatrixFunction A) { funcA = A; }
+
+  // Set the function for assembling the matrix used to construct the preconditioner at a
+  // given quadrature node, with arguments (a0, a1, a2, ω) for a0 K + a1 C + a2 M.
+  void SetPreconditionerUpdate(PreconditionerFunction P) override { funcP = P; }
+
+  // The linear solver is reconfigured with the system and preconditioner matrices at each
+  // quadrature node.
+  void SetLinearSolver(ComplexKspSolver &ksp) override { opInv = &ksp; }
+
+  // Set the projection operator for enforcing the divergence-free constraint.
+  void SetDivFreeProjector(const DivFreeSolver<ComplexVector> &divfree) override
+  {
+    opProj = &divfree;
+  }
+
+  // Set optional B matrix used for weighted inner products. This must be set explicitly
+  // even for generalized problems, otherwise the identity will be used.
+  void SetBMat(const Operator &B) override { opB = &B; }
+
+  // Get scaling factors used by the solver.
+  double GetScalingGamma() const override { return 1.0; }
+  double GetScalingDelta() const override { return 1.0; }
+
+  // Set the number of required eigenmodes and the probe block size. If the moment matrix
+  // has full rank, the probe block is doubled in size (up to four times the initial size)
+  // and the contour integration repeated, since the contour may enclose more eigenvalues
+  // than the probe block can resolve.
+  void SetNumModes(int num_eig, int num_vec = 0) override;
+
+  // Set solver tolerance.
+  void SetTol(double tol) override { rtol = tol; }
+
+  // Set maximum number of contour integration iterations.
+  void SetMaxIter(int it) override { max_it = it; }
+
+  // The contour defines the part of the spectrum to search for, so these are ignored.
+  void SetWhichEigenpairs(WhichType type) override {}
+  void SetShiftInvert(std::complex<double> s, bool precond = false) override {}
+
+  // Set the elliptical contour enclosing the eigenvalues λ of interest, and the number of
+  // quadrature points used to discretize it.
+  void SetContour(std::complex<double> c, double r_x, double r_y, int n);
+
+  // Set an initial vector for the probe block.
+  void SetInitialSpace(const ComplexVector &v) override { v0 = v; }
+
+  // Solve the eigenvalue problem. Returns the number of converged eigenvalues.
+  int Solve() override;
+
+  // Get the corresponding eigenvalue.
+  std::complex<double> GetEigenvalue(int i) const override;
+
+  // Get the corresponding eigenvector. Eigenvectors are normalized such that ||x||₂ = 1,
+  // unless the B-matrix is set for weighted inner products.
+  void GetEigenvector(int i, ComplexVector &x) const override;
+
+  // Get the corresponding eigenpair error.
+  double GetError(int i, ErrorType type) const override;
+
+  // Re-normalize the given number of eigenvectors, for example if the matrix B for weighted
+  // inner products has changed. This does not perform re-orthogonalization with respect to
+  // the new matrix, only normalization.
+  void RescaleEigenvectors(int num_eig) override;
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_BEYN_HPP
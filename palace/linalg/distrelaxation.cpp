@@ -78,8 +78,12 @@ inline void RealAddMult(const Operator &op, const Vector &x, Vector &y)
 
 inline void RealAddMult(const Operator &op, const ComplexVector &x, ComplexVector &y)
 {
-  op.AddMult(x.Real(), y.Real(), 1.0);
-  op.AddMult(x.Imag(), y.Imag(), 1.0);
+  // Apply to the real and imaginary parts as a two-column block.
+  const Vector *X_[2] = {&x.Real(), &x.Imag()};
+  Vector *Y_[2] = {&y.Real(), &y.Imag()};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayAddMult(X, Y, 1.0);
 }
 
 inline void RealMultTranspose(const Operator &op, const Vector &x, Vector &y)
@@ -89,8 +93,11 @@ inline void RealMultTranspose(const Operator &op, const Vector &x, Vector &y)
 
 inline void RealMultTranspose(const Operator &op, const ComplexVector &x, ComplexVector &y)
 {
-  op.MultTranspose(x.Real(), y.Real());
-  op.MultTranspose(x.Imag(), y.Imag());
+  const Vector *X_[2] = {&x.Real(), &x.Imag()};
+  Vector *Y_[2] = {&y.Real(), &y.Imag()};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayMultTranspose(X, Y);
 }
 
 }  // namespace
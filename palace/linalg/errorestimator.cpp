@@ -3,6 +3,8 @@
 
 #include "errorestimator.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include "fem/bilinearform.hpp"
 #include "fem/integrator.hpp"
@@ -64,7 +66,8 @@ auto BuildLevelParOperator(std::unique_ptr<Operator> &&a, const FiniteElementSpa
 
 template <typename OperType>
 auto ConfigureLinearSolver(const FiniteElementSpaceHierarchy &fespaces, double tol,
-                           int max_it, int print, bool use_mg)
+                           int max_it, int print, bool use_mg, bool use_initial_guess,
+                           IterativeSolver<OperType> *&krylov)
 {
   // The system matrix for the projection is real, SPD and diagonally dominant.
   std::unique_ptr<Solver<OperType>> pc;
@@ -84,8 +87,8 @@ auto ConfigureLinearSolver(const FiniteElementSpaceHierarchy &fespaces, double t
       pc = std::make_unique<GeometricMultigridSolver<OperType>>(
           fespaces.GetFinestFESpace().GetComm(),
           std::make_unique<MfemWrapperSolver<OperType>>(std::move(amg)),
-          fespaces.GetProlongationOperators(), nullptr, 1, 1, mg_smooth_order, 1.0, 0.0,
-          true);
+          fespaces.GetProlongationOperators(), nullptr, 1, MultigridCycle::V_CYCLE, 1,
+          mg_smooth_order, 1.0, 0.0, true);
     }
     else
     {
@@ -94,10 +97,11 @@ auto ConfigureLinearSolver(const FiniteElementSpaceHierarchy &fespaces, double t
   }
   auto pcg =
       std::make_unique<CgSolver<OperType>>(fespaces.GetFinestFESpace().GetComm(), print);
-  pcg->SetInitialGuess(false);
+  pcg->SetInitialGuess(use_initial_guess);
   pcg->SetRelTol(tol);
   pcg->SetAbsTol(std::numeric_limits<double>::epsilon());
   pcg->SetMaxIter(max_it);
+  krylov = pcg.get();
   return std::make_unique<BaseKspSolver<OperType>>(std::move(pcg), std::move(pc));
 }
 
@@ -107,7 +111,10 @@ template <typename VecType>
 FluxProjector<VecType>::FluxProjector(const MaterialPropertyCoefficient &coeff,
                                       const FiniteElementSpaceHierarchy &smooth_fespaces,
                                       const FiniteElementSpace &rhs_fespace, double tol,
-                                      int max_it, int print, bool use_mg)
+                                      int max_it, int print, bool use_mg,
+                                      int initial_guess, bool adaptive_tol)
+  : initial_guess(initial_guess), num_prev(0), tol(tol), adaptive_tol(adaptive_tol),
+    flux_norm2(0.0)
 {
   BlockTimer bt(Timer::CONSTRUCT_ESTIMATOR);
   const auto &smooth_fespace = smooth_fespaces.GetFinestFESpace();
@@ -139,10 +146,21 @@ FluxProjector<VecType>::FluxProjector(const MaterialPropertyCoefficient &coeff,
     Flux = BuildLevelParOperator<OperType>(flux.PartialAssemble(), rhs_fespace,
                                            smooth_fespace);
   }
-  ksp = ConfigureLinearSolver<OperType>(smooth_fespaces, tol, max_it, print, use_mg);
+  ksp = ConfigureLinearSolver<OperType>(smooth_fespaces, tol, max_it, print, use_mg,
+                                        initial_guess > 0, krylov);
   ksp->SetOperators(*M, *M);
   rhs.SetSize(smooth_fespace.GetTrueVSize());
   rhs.UseDevice(true);
+  if (initial_guess > 0)
+  {
+    y_prev.SetSize(smooth_fespace.GetTrueVSize());
+    y_prev.UseDevice(true);
+  }
+  if (initial_guess > 1)
+  {
+    y_prev2.SetSize(smooth_fespace.GetTrueVSize());
+    y_prev2.UseDevice(true);
+  }
 }
 
 template <typename VecType>
@@ -153,7 +171,56 @@ void FluxProjector<VecType>::Mult(const VecType &x, VecType &y) const
               "Invalid vector dimensions for FluxProjector::Mult!");
   // Mpi::Print(" Computing smooth flux recovery (projection) for error estimation\n");
   Flux->Mult(x, rhs);
+  if (initial_guess > 0)
+  {
+    // Warm start from the previous recovered flux(es), for example at the previous
+    // frequency or time step.
+    if (num_prev == 0)
+    {
+      y = 0.0;
+    }
+    else if (initial_guess == 1 || num_prev == 1)
+    {
+      y = y_prev;
+    }
+    else
+    {
+      y = y_prev2;
+      linalg::AXPBY(2.0, y_prev, -1.0, y);
+    }
+  }
   ksp->Mult(rhs, y);
+  if (initial_guess > 1)
+  {
+    std::swap(y_prev, y_prev2);
+  }
+  if (initial_guess > 0)
+  {
+    y_prev = y;
+    num_prev++;
+  }
+  if (adaptive_tol)
+  {
+    // Since M y ≈ rhs, yᴴ rhs approximates the squared L² norm of the recovered flux.
+    flux_norm2 = std::abs(linalg::Dot(krylov->GetComm(), y, rhs));
+  }
+}
+
+template <typename VecType>
+void FluxProjector<VecType>::UpdateTol(const Vector &estimates) const
+{
+  if (!adaptive_tol)
+  {
+    return;
+  }
+
+  // Target a projection error an order of magnitude below the estimated relative error
+  // (only the relative size of the indicators matters), but never looser than 1%.
+  constexpr double safety = 0.1, max_tol = 1.0e-2;
+  double err2 = linalg::LocalSum(estimates);
+  Mpi::GlobalSum(1, &err2, krylov->GetComm());
+  const double rel_err = (flux_norm2 > 0.0) ? std::sqrt(err2 / flux_norm2) : 0.0;
+  krylov->SetRelTol(std::clamp(safety * rel_err, tol, std::max(tol, max_tol)));
 }
 
 namespace
@@ -242,6 +309,7 @@ Vector ComputeErrorEstimates(const VecType &F, VecType &F_gf, VecType &G, VecTyp
     // Cleanup.
     PalaceCeedCall(ceed, CeedVectorDestroy(&estimates_vec));
   }
+  projector.UpdateTol(estimates);
 
   return estimates;
 }
@@ -252,11 +320,12 @@ template <typename VecType>
 GradFluxErrorEstimator<VecType>::GradFluxErrorEstimator(
     const MaterialOperator &mat_op, FiniteElementSpace &nd_fespace,
     FiniteElementSpaceHierarchy &rt_fespaces, double tol, int max_it, int print,
-    bool use_mg)
+    bool use_mg, int initial_guess, bool adaptive_tol)
   : nd_fespace(nd_fespace), rt_fespace(rt_fespaces.GetFinestFESpace()),
     projector(MaterialPropertyCoefficient(mat_op.GetAttributeToMaterial(),
                                           mat_op.GetPermittivityReal()),
-              rt_fespaces, nd_fespace, tol, max_it, print, use_mg),
+              rt_fespaces, nd_fespace, tol, max_it, print, use_mg, initial_guess,
+              adaptive_tol),
     integ_op(nd_fespace.GetMesh().GetNE(), nd_fespace.GetVSize()),
     E_gf(nd_fespace.GetVSize()), D(rt_fespace.GetTrueVSize()), D_gf(rt_fespace.GetVSize())
 {
@@ -370,11 +439,12 @@ template <typename VecType>
 CurlFluxErrorEstimator<VecType>::CurlFluxErrorEstimator(
     const MaterialOperator &mat_op, FiniteElementSpace &rt_fespace,
     FiniteElementSpaceHierarchy &nd_fespaces, double tol, int max_it, int print,
-    bool use_mg)
+    bool use_mg, int initial_guess, bool adaptive_tol)
   : rt_fespace(rt_fespace), nd_fespace(nd_fespaces.GetFinestFESpace()),
     projector(MaterialPropertyCoefficient(mat_op.GetAttributeToMaterial(),
                                           mat_op.GetInvPermeability()),
-              nd_fespaces, rt_fespace, tol, max_it, print, use_mg),
+              nd_fespaces, rt_fespace, tol, max_it, print, use_mg, initial_guess,
+              adaptive_tol),
     integ_op(nd_fespace.GetMesh().GetNE(), rt_fespace.GetVSize()),
     B_gf(rt_fespace.GetVSize()), H(nd_fespace.GetTrueVSize()), H_gf(nd_fespace.GetVSize())
 {
@@ -482,17 +552,18 @@ template <typename VecType>
 TimeDependentFluxErrorEstimator<VecType>::TimeDependentFluxErrorEstimator(
     const MaterialOperator &mat_op, FiniteElementSpaceHierarchy &nd_fespaces,
     FiniteElementSpaceHierarchy &rt_fespaces, double tol, int max_it, int print,
-    bool use_mg)
+    bool use_mg, int initial_guess, bool adaptive_tol)
   : grad_estimator(mat_op, nd_fespaces.GetFinestFESpace(), rt_fespaces, tol, max_it, print,
-                   use_mg),
+                   use_mg, initial_guess, adaptive_tol),
     curl_estimator(mat_op, rt_fespaces.GetFinestFESpace(), nd_fespaces, tol, max_it, print,
-                   use_mg)
+                   use_mg, initial_guess, adaptive_tol)
 {
 }
 
 template <typename VecType>
 void TimeDependentFluxErrorEstimator<VecType>::AddErrorIndicator(
-    const VecType &E, const VecType &B, double Et, ErrorIndicator &indicator) const
+    const VecType &E, const VecType &B, double Et, ErrorIndicator &indicator,
+    double w) const
 {
   auto grad_estimates =
       ComputeErrorEstimates(E, grad_estimator.E_gf, grad_estimator.D, grad_estimator.D_gf,
@@ -505,7 +576,7 @@ void TimeDependentFluxErrorEstimator<VecType>::AddErrorIndicator(
   grad_estimates += curl_estimates;  // Sum of squares
   linalg::Sqrt(grad_estimates,
                (Et > 0.0) ? 0.5 / Et : 1.0);  // Correct factor of 1/2 in energy
-  indicator.AddIndicator(grad_estimates);
+  indicator.AddIndicator(grad_estimates, w);
 }
 
 template class FluxProjector<Vector>;
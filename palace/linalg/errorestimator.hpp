@@ -9,6 +9,7 @@
 #include "fem/errorindicator.hpp"
 #include "fem/fespace.hpp"
 #include "fem/libceed/operator.hpp"
+#include "linalg/iterative.hpp"
 #include "linalg/ksp.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/vector.hpp"
@@ -40,19 +41,41 @@ private:
   // Operator for the mass matrix inversion.
   std::unique_ptr<OperType> Flux, M;
 
-  // Linear solver and preconditioner for the projected linear system.
+  // Linear solver and preconditioner for the projected linear system, and reference to
+  // the Krylov solver (owned by ksp) for tolerance updates.
   std::unique_ptr<BaseKspSolver<OperType>> ksp;
-
-  // Workspace object for solver application.
+  IterativeSolver<OperType> *krylov;
+
+  // Initial guess strategy for the projection (0: zero, 1: previous recovered flux, 2:
+  // linear extrapolation from the two previous recovered fluxes), and storage for the
+  // previous solutions.
+  int initial_guess;
+  mutable int num_prev;
+  mutable VecType y_prev, y_prev2;
+
+  // Relative tolerance for the projection (the minimum tolerance when adapted), and
+  // whether to adapt it to the magnitude of the estimated error.
+  double tol;
+  bool adaptive_tol;
+
+  // Workspace object for solver application, and the squared norm of the last recovered
+  // flux.
   mutable VecType rhs;
+  mutable double flux_norm2;
 
 public:
   FluxProjector(const MaterialPropertyCoefficient &coeff,
                 const FiniteElementSpaceHierarchy &smooth_fespaces,
                 const FiniteElementSpace &rhs_fespace, double tol, int max_it, int print,
-                bool use_mg);
+                bool use_mg, int initial_guess = 0, bool adaptive_tol = false);
 
   void Mult(const VecType &x, VecType &y) const;
+
+  // Update the relative tolerance for subsequent projections given the squared element
+  // error estimates computed from the last recovered flux. The solution only needs to be
+  // accurate relative to the estimated discretization error, so the tolerance is relaxed
+  // when the error is large (the minimum tolerance is used when not adaptive).
+  void UpdateTol(const Vector &estimates) const;
 };
 
 // Class used for computing gradient flux error estimate, η_K = || ε Eₕ - D ||_K, where D
@@ -78,7 +101,8 @@ private:
 public:
   GradFluxErrorEstimator(const MaterialOperator &mat_op, FiniteElementSpace &nd_fespace,
                          FiniteElementSpaceHierarchy &rt_fespaces, double tol, int max_it,
-                         int print, bool use_mg);
+                         int print, bool use_mg, int initial_guess = 0,
+                         bool adaptive_tol = false);
 
   // Compute elemental error indicators given the electric field as a vector of true dofs,
   // and fold into an existing indicator. The indicators are nondimensionalized using the
@@ -110,7 +134,8 @@ private:
 public:
   CurlFluxErrorEstimator(const MaterialOperator &mat_op, FiniteElementSpace &rt_fespace,
                          FiniteElementSpaceHierarchy &nd_fespaces, double tol, int max_it,
-                         int print, bool use_mg);
+                         int print, bool use_mg, int initial_guess = 0,
+                         bool adaptive_tol = false);
 
   // Compute elemental error indicators given the magnetic flux density as a vector of true
   // dofs, and fold into an existing indicator. The indicators are nondimensionalized using
@@ -133,13 +158,14 @@ public:
   TimeDependentFluxErrorEstimator(const MaterialOperator &mat_op,
                                   FiniteElementSpaceHierarchy &nd_fespaces,
                                   FiniteElementSpaceHierarchy &rt_fespaces, double tol,
-                                  int max_it, int print, bool use_mg);
+                                  int max_it, int print, bool use_mg,
+                                  int initial_guess = 0, bool adaptive_tol = false);
 
   // Compute elemental error indicators given the electric field and magnetic flux density
-  // as a vectors of true dofs, and fold into an existing indicator. The indicators are
-  // nondimensionalized using the total field energy.
+  // as a vectors of true dofs, and fold into an existing indicator with the given sample
+  // weight. The indicators are nondimensionalized using the total field energy.
   void AddErrorIndicator(const VecType &E, const VecType &B, double Et,
-                         ErrorIndicator &indicator) const;
+                         ErrorIndicator &indicator, double w = 1.0) const;
 };
 
 }  // namespace palace
@@ -16,11 +16,11 @@ template <typename OperType>
 GeometricMultigridSolver<OperType>::GeometricMultigridSolver(
     MPI_Comm comm, std::unique_ptr<Solver<OperType>> &&coarse_solver,
     const std::vector<const Operator *> &P, const std::vector<const Operator *> *G,
-    int cycle_it, int smooth_it, int cheby_order, double cheby_sf_max, double cheby_sf_min,
-    bool cheby_4th_kind)
-  : Solver<OperType>(), pc_it(cycle_it), P(P.begin(), P.end()), A(P.size() + 1),
-    dbc_tdof_lists(P.size()), B(P.size() + 1), X(P.size() + 1), Y(P.size() + 1),
-    R(P.size() + 1), use_timer(false)
+    int cycle_it, MultigridCycle cycle_type, int smooth_it, int cheby_order,
+    double cheby_sf_max, double cheby_sf_min, bool cheby_4th_kind)
+  : Solver<OperType>(), comm(comm), pc_it(cycle_it), cycle_type(cycle_type),
+    P(P.begin(), P.end()), A(P.size() + 1), dbc_tdof_lists(P.size()), B(P.size() + 1),
+    X(P.size() + 1), Y(P.size() + 1), R(P.size() + 1), use_timer(false)
 {
   // Configure levels of geometric coarsening. Multigrid vectors will be configured at first
   // call to Mult. The multigrid operator size is set based on the finest space dimension.
@@ -117,6 +117,20 @@ void GeometricMultigridSolver<OperType>::SetOperator(const OperType &op)
     Y[l].UseDevice(true);
     R[l].UseDevice(true);
   }
+  if (cycle_type == MultigridCycle::K_CYCLE)
+  {
+    // Krylov acceleration is only applied on intermediate levels (not the finest or the
+    // coarsest).
+    C.resize(n_levels);
+    V.resize(n_levels);
+    for (std::size_t l = 1; l + 1 < n_levels; l++)
+    {
+      C[l].SetSize(A[l]->Height());
+      V[l].SetSize(A[l]->Height());
+      C[l].UseDevice(true);
+      V[l].UseDevice(true);
+    }
+  }
 
   this->height = op.Height();
   this->width = op.Width();
@@ -132,11 +146,11 @@ void GeometricMultigridSolver<OperType>::Mult(const VecType &x, VecType &y) cons
   MFEM_ASSERT(n_levels > 1 || pc_it == 1,
               "Single-level geometric multigrid will not work with multiple iterations!");
 
-  // Apply V-cycle. The initial guess for y is zero'd at the first pre-smooth iteration.
+  // Apply cycle. The initial guess for y is zero'd at the first pre-smooth iteration.
   X.back() = x;
   for (int it = 0; it < pc_it; it++)
   {
-    VCycle(n_levels - 1, (it > 0));
+    Cycle(n_levels - 1, (it > 0));
   }
   y = Y.back();
 }
@@ -151,8 +165,13 @@ inline void RealMult(const Operator &op, const Vector &x, Vector &y)
 
 inline void RealMult(const Operator &op, const ComplexVector &x, ComplexVector &y)
 {
-  op.Mult(x.Real(), y.Real());
-  op.Mult(x.Imag(), y.Imag());
+  // Transfer the real and imaginary parts as a two-column block, so the operator data is
+  // traversed once for both.
+  const Vector *X_[2] = {&x.Real(), &x.Imag()};
+  Vector *Y_[2] = {&y.Real(), &y.Imag()};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayMult(X, Y);
 }
 
 inline void RealMultTranspose(const Operator &op, const Vector &x, Vector &y)
@@ -162,14 +181,17 @@ inline void RealMultTranspose(const Operator &op, const Vector &x, Vector &y)
 
 inline void RealMultTranspose(const Operator &op, const ComplexVector &x, ComplexVector &y)
 {
-  op.MultTranspose(x.Real(), y.Real());
-  op.MultTranspose(x.Imag(), y.Imag());
+  const Vector *X_[2] = {&x.Real(), &x.Imag()};
+  Vector *Y_[2] = {&y.Real(), &y.Imag()};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayMultTranspose(X, Y);
 }
 
 }  // namespace
 
 template <typename OperType>
-void GeometricMultigridSolver<OperType>::VCycle(int l, bool initial_guess) const
+void GeometricMultigridSolver<OperType>::Cycle(int l, bool initial_guess) const
 {
   // Pre-smooth, with zero initial guess (Y = 0 set inside). This is the coarse solve at
   // level 0. Important to note that the smoothers must respect the initial guess flag
@@ -193,7 +215,28 @@ void GeometricMultigridSolver<OperType>::VCycle(int l, bool initial_guess) const
   {
     linalg::SetSubVector(X[l - 1], *dbc_tdof_lists[l - 1], 0.0);
   }
-  VCycle(l - 1, false);
+  if (l - 1 == 0)
+  {
+    Cycle(l - 1, false);
+  }
+  else
+  {
+    switch (cycle_type)
+    {
+      case MultigridCycle::V_CYCLE:
+        Cycle(l - 1, false);
+        break;
+      case MultigridCycle::W_CYCLE:
+        // The right-hand side X[l - 1] is not modified by the cycle on level l - 1, so the
+        // second visit reuses it with the first correction as the initial guess.
+        Cycle(l - 1, false);
+        Cycle(l - 1, true);
+        break;
+      case MultigridCycle::K_CYCLE:
+        KCycle(l - 1);
+        break;
+    }
+  }
 
   // Prolongate and add.
   RealMult(*P[l - 1], Y[l - 1], R[l]);
@@ -204,6 +247,49 @@ void GeometricMultigridSolver<OperType>::VCycle(int l, bool initial_guess) const
   B[l]->MultTranspose2(X[l], Y[l], R[l]);
 }
 
+template <typename OperType>
+void GeometricMultigridSolver<OperType>::KCycle(int l) const
+{
+  // Two iterations of a flexible minimal residual (GCR) method for A[l] Y[l] = X[l],
+  // preconditioned with a single cycle on level l (see Notay and Vassilevski, Numer. Linear
+  // Algebra Appl. 15 (2008)). The second iteration is skipped if the first already reduces
+  // the residual sufficiently. This uses the general (non-Hermitian) variant so it applies
+  // also to indefinite or complex-symmetric operators.
+  constexpr double k_cycle_tol = 0.25;
+  const double norm_r = linalg::Norml2(comm, X[l]);
+
+  // First iteration: c₁ = B r, v₁ = A c₁, α₁ = (v₁, r) / (v₁, v₁).
+  Cycle(l, false);
+  C[l] = Y[l];
+  A[l]->Mult(C[l], V[l]);
+  const double rho1 = std::abs(linalg::Dot(comm, V[l], V[l]));
+  if (rho1 == 0.0)
+  {
+    return;
+  }
+  const auto alpha1 = linalg::Dot(comm, X[l], V[l]) / rho1;
+
+  // Update the residual in place (the right-hand side is no longer needed).
+  linalg::AXPY(-alpha1, V[l], X[l]);
+  if (linalg::Norml2(comm, X[l]) <= k_cycle_tol * norm_r)
+  {
+    Y[l] *= alpha1;
+    return;
+  }
+
+  // Second iteration: c₂ = B r̃, v₂ = A c₂ orthogonalized against v₁, α₂ = (v₂, r̃) /
+  // (v₂, v₂).
+  Cycle(l, false);
+  A[l]->Mult(Y[l], R[l]);
+  const auto beta = linalg::Dot(comm, R[l], V[l]) / rho1;
+  linalg::AXPY(-beta, V[l], R[l]);
+  linalg::AXPY(-beta, C[l], Y[l]);
+  const double rho2 = std::abs(linalg::Dot(comm, R[l], R[l]));
+  const auto alpha2 = (rho2 > 0.0) ? linalg::Dot(comm, X[l], R[l]) / rho2
+                                   : decltype(alpha1)(0.0);
+  linalg::AXPBY(alpha1, C[l], alpha2, Y[l]);
+}
+
 template class GeometricMultigridSolver<Operator>;
 template class GeometricMultigridSolver<ComplexOperator>;
 
@@ -33,9 +33,15 @@ class GeometricMultigridSolver : public Solver<OperType>
   using VecType = typename Solver<OperType>::VecType;
 
 private:
-  // Number of V-cycles per preconditioner application.
+  // Communicator for inner products in Krylov-accelerated cycles.
+  MPI_Comm comm;
+
+  // Number of cycles per preconditioner application.
   const int pc_it;
 
+  // Type of multigrid cycle.
+  const MultigridCycle cycle_type;
+
   // Prolongation operators (not owned).
   std::vector<const Operator *> P;
 
@@ -50,27 +56,34 @@ private:
   // MFEM Operator interface for multiple RHS.
   mutable std::vector<VecType> X, Y, R;
 
+  // Additional temporary vectors for the Krylov acceleration of K-cycles.
+  mutable std::vector<VecType> C, V;
+
   // Enable timer contribution for Timer::KSP_COARSE_SOLVE.
   bool use_timer;
 
-  // Internal function to perform a single V-cycle iteration.
-  void VCycle(int l, bool initial_guess) const;
+  // Internal function to perform a single cycle iteration (V-, W-, or K-cycle) at level l.
+  void Cycle(int l, bool initial_guess) const;
+
+  // Internal function to compute the coarse-level correction Y[l] for the right-hand side
+  // X[l] using Krylov-accelerated cycles at level l.
+  void KCycle(int l) const;
 
 public:
   GeometricMultigridSolver(MPI_Comm comm, std::unique_ptr<Solver<OperType>> &&coarse_solver,
                            const std::vector<const Operator *> &P,
                            const std::vector<const Operator *> *G, int cycle_it,
-                           int smooth_it, int cheby_order, double cheby_sf_max,
-                           double cheby_sf_min, bool cheby_4th_kind);
+                           MultigridCycle cycle_type, int smooth_it, int cheby_order,
+                           double cheby_sf_max, double cheby_sf_min, bool cheby_4th_kind);
   GeometricMultigridSolver(const IoData &iodata, MPI_Comm comm,
                            std::unique_ptr<Solver<OperType>> &&coarse_solver,
                            const std::vector<const Operator *> &P,
                            const std::vector<const Operator *> *G = nullptr)
     : GeometricMultigridSolver(
           comm, std::move(coarse_solver), P, G, iodata.solver.linear.mg_cycle_it,
-          iodata.solver.linear.mg_smooth_it, iodata.solver.linear.mg_smooth_order,
-          iodata.solver.linear.mg_smooth_sf_max, iodata.solver.linear.mg_smooth_sf_min,
-          iodata.solver.linear.mg_smooth_cheby_4th)
+          iodata.solver.linear.mg_cycle_type, iodata.solver.linear.mg_smooth_it,
+          iodata.solver.linear.mg_smooth_order, iodata.solver.linear.mg_smooth_sf_max,
+          iodata.solver.linear.mg_smooth_sf_min, iodata.solver.linear.mg_smooth_cheby_4th)
   {
   }
 
@@ -100,7 +100,8 @@ WeightedHCurlNormSolver<VecType>::WeightedHCurlNormSolver(
         std::max(nd_fespaces.GetFinestFESpace().GetMaxElementOrder(), 2);
     pc = std::make_unique<GeometricMultigridSolver<OperType>>(
         nd_fespaces.GetFinestFESpace().GetComm(), std::move(ams),
-        nd_fespaces.GetProlongationOperators(), &G, 1, 1, mg_smooth_order, 1.0, 0.0, true);
+        nd_fespaces.GetProlongationOperators(), &G, 1, MultigridCycle::V_CYCLE, 1,
+        mg_smooth_order, 1.0, 0.0, true);
   }
   else
   {
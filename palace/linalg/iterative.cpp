@@ -6,7 +6,10 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 #include <string>
+#include <Eigen/Dense>
+#include <Eigen/Eigenvalues>
 #include "linalg/orthog.hpp"
 #include "utils/communication.hpp"
 #include "utils/timer.hpp"
@@ -248,6 +251,44 @@ inline void ApplyB(const Solver<OperType> *B, const VecType &x, VecType &y,
   B->Mult(x, y);
 }
 
+template <typename VecType>
+inline void BlockGram(MPI_Comm comm, const std::vector<VecType> &X,
+                      const std::vector<VecType> &Y, const std::vector<int> &cols,
+                      mfem::DenseMatrix &G)
+{
+  // Computes G = Xᵀ Y for the active columns with a single global reduction.
+  const int s = static_cast<int>(cols.size());
+  G.SetSize(s);
+  for (int j = 0; j < s; j++)
+  {
+    for (int i = 0; i < s; i++)
+    {
+      G(i, j) = linalg::LocalDot(X[cols[i]], Y[cols[j]]);
+    }
+  }
+  Mpi::GlobalSum(s * s, G.Data(), comm);
+}
+
+inline bool BlockSolve(mfem::DenseMatrix G, mfem::DenseMatrix &C)
+{
+  // Overwrites C with G⁻¹ C, returning false if the (small, dense) Gram matrix G is
+  // numerically singular.
+  const int s = G.Height();
+  double g_max = 0.0;
+  for (int i = 0; i < s; i++)
+  {
+    g_max = std::max(g_max, std::abs(G(i, i)));
+  }
+  mfem::Array<int> ipiv(s);
+  mfem::LUFactors lu(G.Data(), ipiv.GetData());
+  if (!lu.Factor(s, s * std::numeric_limits<double>::epsilon() * g_max))
+  {
+    return false;
+  }
+  lu.Solve(s, C.Width(), C.Data());
+  return true;
+}
+
 template <typename OperType, typename VecType>
 inline void InitialResidual(PreconditionerSide side, const OperType *A,
                             const Solver<OperType> *B, const VecType &b, VecType &x,
@@ -358,13 +399,20 @@ IterativeSolver<OperType>::IterativeSolver(MPI_Comm comm, int print)
 
 template <typename OperType>
 void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  Solve(b, x, this->initial_guess, max_it);
+}
+
+template <typename OperType>
+void CgSolver<OperType>::Solve(const VecType &b, VecType &x, bool guess,
+                                int max_iter) const
 {
   // Set up workspace.
   ScalarType beta, beta_prev = 0.0, alpha, denom;
   RealType res, eps;
-  MFEM_VERIFY(A, "Operator must be set for CgSolver::Mult!");
+  MFEM_VERIFY(A, "Operator must be set for CgSolver::Solve!");
   MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
-              "Size mismatch for CgSolver::Mult!");
+              "Size mismatch for CgSolver::Solve!");
   r.SetSize(A->Height());
   z.SetSize(A->Height());
   p.SetSize(A->Height());
@@ -373,7 +421,7 @@ void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
   p.UseDevice(true);
 
   // Initialize.
-  if (this->initial_guess)
+  if (guess)
   {
     A->Mult(x, r);
     linalg::AXPBY(1.0, b, -1.0, r);
@@ -394,7 +442,7 @@ void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
   beta = linalg::Dot(comm, z, r);
   CheckDot(beta, "PCG preconditioner is not positive definite: (Br, r) = ");
   res = std::sqrt(std::abs(beta));
-  if (this->initial_guess)
+  if (guess)
   {
     ScalarType beta_rhs;
     if (B)
@@ -423,7 +471,7 @@ void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
     Mpi::Print(comm, "{}Residual norms for PCG solve\n",
                std::string(tab_width + int_width - 1, ' '));
   }
-  for (; it < max_it && !converged; it++)
+  for (; it < max_iter && !converged; it++)
   {
     if (print_opts.iterations)
     {
@@ -484,6 +532,369 @@ void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
   final_it = it;
 }
 
+template <typename OperType>
+void CgSolver<OperType>::BlockMult(const mfem::Array<const VecType *> &b,
+                                   mfem::Array<VecType *> &x) const
+{
+  MFEM_VERIFY(b.Size() == x.Size(), "Size mismatch for CgSolver::BlockMult!");
+  const int n = b.Size();
+
+  // Statistics for the block solve are those of the column with the largest relative
+  // residual, and the iteration count is the total over all columns.
+  bool block_converged = true;
+  int block_it = 0;
+  double block_initial_res = 1.0, block_final_res = 0.0;
+  auto UpdateStats = [&](double res0, double res, int its, bool conv)
+  {
+    if (res * block_initial_res >= block_final_res * res0)
+    {
+      block_initial_res = res0;
+      block_final_res = res;
+    }
+    block_it += its;
+    block_converged = block_converged && conv;
+  };
+  auto SetStats = [&]()
+  {
+    converged = block_converged;
+    initial_res = block_initial_res;
+    final_res = block_final_res;
+    final_it = block_it;
+  };
+
+  if constexpr (std::is_same<OperType, ComplexOperator>::value)
+  {
+    // No multiple-vector operator application for complex-valued operators.
+    for (int j = 0; j < n; j++)
+    {
+      Mult(*b[j], *x[j]);
+      UpdateStats(initial_res, final_res, final_it, converged);
+    }
+    SetStats();
+  }
+  else
+  {
+    if (n == 1)
+    {
+      Mult(*b[0], *x[0]);
+      return;
+    }
+    MFEM_VERIFY(A, "Operator must be set for CgSolver::BlockMult!");
+
+    // Set up workspace. Residuals are stored for the columns in cols which are active in
+    // the block, and P holds the s current search directions.
+    std::vector<VecType> R(n), Z(n), P(n), Q(n), W(n);
+    for (int j = 0; j < n; j++)
+    {
+      MFEM_ASSERT(A->Width() == x[j]->Size() && A->Height() == b[j]->Size(),
+                  "Size mismatch for CgSolver::BlockMult!");
+      for (auto *v : {&R[j], &Z[j], &P[j], &Q[j], &W[j]})
+      {
+        v->SetSize(A->Height());
+        v->UseDevice(true);
+      }
+    }
+    std::vector<int> cols(n), dirs;
+    std::iota(cols.begin(), cols.end(), 0);
+    auto ApplyArray = [](const Operator &op, const std::vector<VecType> &X,
+                         std::vector<VecType> &Y, const std::vector<int> &idx)
+    {
+      mfem::Array<const Vector *> X_(static_cast<int>(idx.size()));
+      mfem::Array<Vector *> Y_(static_cast<int>(idx.size()));
+      for (int jj = 0; jj < X_.Size(); jj++)
+      {
+        X_[jj] = &X[idx[jj]];
+        Y_[jj] = &Y[idx[jj]];
+      }
+      op.ArrayMult(X_, Y_);
+    };
+    auto ApplyArrayB = [&](const std::vector<VecType> &X, std::vector<VecType> &Y)
+    {
+      if (B)
+      {
+        BlockTimer bt(Timer::KSP_PRECONDITIONER, this->use_timer);
+        ApplyArray(*B, X, Y, cols);
+      }
+      else
+      {
+        for (auto j : cols)
+        {
+          Y[j] = X[j];
+        }
+      }
+    };
+    auto ResidualNorms = [&](std::vector<RealType> &res)
+    {
+      std::vector<RealType> dot(cols.size());
+      for (std::size_t jj = 0; jj < cols.size(); jj++)
+      {
+        dot[jj] = linalg::LocalDot(Z[cols[jj]], R[cols[jj]]);
+      }
+      Mpi::GlobalSum(static_cast<int>(dot.size()), dot.data(), comm);
+      for (std::size_t jj = 0; jj < cols.size(); jj++)
+      {
+        CheckDot(dot[jj], "PCG preconditioner is not positive definite: (Br, r) = ");
+        res[cols[jj]] = std::sqrt(std::abs(dot[jj]));
+      }
+    };
+
+    // Initialize.
+    if (this->initial_guess)
+    {
+      for (int j = 0; j < n; j++)
+      {
+        P[j] = *x[j];
+      }
+      ApplyArray(*A, P, R, cols);
+      for (int j = 0; j < n; j++)
+      {
+        linalg::AXPBY(1.0, *b[j], -1.0, R[j]);
+      }
+    }
+    else
+    {
+      for (int j = 0; j < n; j++)
+      {
+        R[j] = *b[j];
+        *x[j] = 0.0;
+      }
+    }
+    ApplyArrayB(R, Z);
+    std::vector<RealType> res(n, 0.0), res0(n, 0.0), eps(n);
+    ResidualNorms(res);
+    if (this->initial_guess)
+    {
+      for (int j = 0; j < n; j++)
+      {
+        Q[j] = *b[j];
+      }
+      ApplyArrayB(Q, P);
+      for (int j = 0; j < n; j++)
+      {
+        res0[j] = linalg::LocalDot(P[j], Q[j]);
+      }
+      Mpi::GlobalSum(n, res0.data(), comm);
+      for (int j = 0; j < n; j++)
+      {
+        CheckDot(res0[j], "PCG preconditioner is not positive definite: (Bb, b) = ");
+        res0[j] = std::sqrt(std::abs(res0[j]));
+      }
+    }
+    else
+    {
+      res0 = res;
+    }
+    for (int j = 0; j < n; j++)
+    {
+      eps[j] = std::max(rel_tol * res0[j], abs_tol);
+    }
+
+    // Remove converged columns from the block.
+    std::vector<int> its(n, 0);
+    auto Deflate = [&](int it)
+    {
+      std::vector<int> cols_keep;
+      for (auto j : cols)
+      {
+        its[j] = it;
+        if (!(res[j] < eps[j]))
+        {
+          cols_keep.push_back(j);
+        }
+      }
+      cols = std::move(cols_keep);
+    };
+
+    // Set the search directions to an orthonormal basis for the span of the active columns
+    // of W, dropping directions which are numerically linearly dependent (breakdown-free
+    // block CG, H. Ji and Y. Li, Numer. Algorithms 2017). This keeps the block Gram matrix
+    // Pᵀ A P nonsingular when the right-hand sides or residuals become dependent.
+    auto Orthonormalize = [&]()
+    {
+      const int m = static_cast<int>(cols.size());
+      Eigen::MatrixXd G(m, m);
+      for (int j = 0; j < m; j++)
+      {
+        for (int i = 0; i <= j; i++)
+        {
+          G(i, j) = G(j, i) = linalg::LocalDot(W[cols[i]], W[cols[j]]);
+        }
+      }
+      Mpi::GlobalSum(m * m, G.data(), comm);
+      Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(G);
+      const auto &lambda = eig.eigenvalues();
+      const auto &V = eig.eigenvectors();
+      const double tol =
+          m * std::numeric_limits<double>::epsilon() * std::max(lambda(m - 1), 0.0);
+      dirs.clear();
+      for (int k = m - 1; k >= 0 && lambda(k) > tol; k--)
+      {
+        const int s = static_cast<int>(dirs.size());
+        P[s] = 0.0;
+        for (int i = 0; i < m; i++)
+        {
+          P[s].Add(V(i, k) / std::sqrt(lambda(k)), W[cols[i]]);
+        }
+        dirs.push_back(s);
+      }
+    };
+    Deflate(0);
+    for (auto j : cols)
+    {
+      W[j] = Z[j];
+    }
+    if (!cols.empty())
+    {
+      Orthonormalize();
+    }
+
+    // Begin iterations.
+    int it = 0;
+    bool breakdown = false;
+    auto MaxRes = [&]()
+    {
+      RealType res_max = 0.0;
+      for (auto j : cols)
+      {
+        res_max = std::max(res_max, res[j]);
+      }
+      return res_max;
+    };
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}Residual norms for block PCG solve ({:d} right-hand sides)\n",
+                 std::string(tab_width + int_width - 1, ' '), n);
+    }
+    mfem::DenseMatrix delta, coef;
+    std::vector<double> gram;
+    for (; it < max_it && !cols.empty(); it++)
+    {
+      if (print_opts.iterations)
+      {
+        Mpi::Print(comm, "{}{:{}d} KSP residual norm max ||r||_B = {:.6e} ({:d} active)\n",
+                   std::string(tab_width, ' '), it, int_width, MaxRes(), cols.size());
+      }
+      const int s = static_cast<int>(dirs.size());
+      int m = static_cast<int>(cols.size());
+      if (s == 0)
+      {
+        breakdown = true;
+        break;
+      }
+
+      // X += P α, R -= Q α with Q = A P and α = (Pᵀ Q)⁻¹ Pᵀ R. Both Gram matrices are
+      // formed with a single reduction.
+      ApplyArray(*A, P, Q, dirs);
+      gram.assign(s * (s + m), 0.0);
+      for (int i = 0; i < s; i++)
+      {
+        for (int k = 0; k < s + m; k++)
+        {
+          gram[i + s * k] = linalg::LocalDot(P[i], (k < s) ? Q[k] : R[cols[k - s]]);
+        }
+      }
+      Mpi::GlobalSum(s * (s + m), gram.data(), comm);
+      delta.UseExternalData(gram.data(), s, s);
+      coef.UseExternalData(gram.data() + s * s, s, m);
+      if (!BlockSolve(delta, coef))
+      {
+        breakdown = true;
+        break;
+      }
+      for (int jj = 0; jj < m; jj++)
+      {
+        auto &xj = *x[cols[jj]];
+        auto &rj = R[cols[jj]];
+        for (int i = 0; i < s; i++)
+        {
+          xj.Add(coef(i, jj), P[i]);
+          rj.Add(-coef(i, jj), Q[i]);
+        }
+      }
+
+      // Check for convergence, and deflate the converged columns.
+      ApplyArrayB(R, Z);
+      ResidualNorms(res);
+      Deflate(it + 1);
+      m = static_cast<int>(cols.size());
+      if (m == 0)
+      {
+        continue;
+      }
+
+      // W = Z + P β with β = -(Pᵀ Q)⁻¹ Qᵀ Z, which makes the new directions A-conjugate to
+      // the current ones also after deflation, so the recurrence does not restart.
+      mfem::DenseMatrix qz(s, m);
+      for (int jj = 0; jj < m; jj++)
+      {
+        for (int i = 0; i < s; i++)
+        {
+          qz(i, jj) = linalg::LocalDot(Q[i], Z[cols[jj]]);
+        }
+      }
+      Mpi::GlobalSum(s * m, qz.Data(), comm);
+      if (!BlockSolve(delta, qz))
+      {
+        breakdown = true;
+        it++;
+        break;
+      }
+      for (int jj = 0; jj < m; jj++)
+      {
+        auto &wj = W[cols[jj]];
+        wj = Z[cols[jj]];
+        for (int i = 0; i < s; i++)
+        {
+          wj.Add(-qz(i, jj), P[i]);
+        }
+      }
+      Orthonormalize();
+    }
+    if (print_opts.iterations && cols.empty())
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm max ||r||_B = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, MaxRes());
+    }
+    if (breakdown && print_opts.warnings)
+    {
+      Mpi::Print(comm,
+                 "{}Block PCG breakdown, continuing with single-vector PCG for {:d} "
+                 "right-hand side{}\n",
+                 std::string(tab_width, ' '), cols.size(), (cols.size() > 1) ? "s" : "");
+    }
+    for (int j = 0; j < n; j++)
+    {
+      if (std::find(cols.begin(), cols.end(), j) == cols.end())
+      {
+        UpdateStats(res0[j], res[j], its[j], res[j] < eps[j]);
+      }
+    }
+    if (breakdown && it < max_it)
+    {
+      // Continue after breakdown from the current iterate, with the remaining iterations.
+      for (auto j : cols)
+      {
+        Solve(*b[j], *x[j], true, max_it - it);
+        UpdateStats(initial_res, final_res, it + final_it, converged);
+      }
+    }
+    else
+    {
+      for (auto j : cols)
+      {
+        UpdateStats(res0[j], res[j], it, false);
+      }
+    }
+    SetStats();
+    if (print_opts.summary || (print_opts.warnings && !converged))
+    {
+      Mpi::Print(comm, "{}Block PCG solver {} in {:d} iteration{} ({:d} total)\n",
+                 std::string(tab_width, ' '), converged ? "converged" : "did NOT converge",
+                 it, (it == 1) ? "" : "s", block_it);
+    }
+  }
+}
+
 template <typename OperType>
 void GmresSolver<OperType>::Initialize() const
 {
@@ -688,6 +1099,450 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
   final_it = it;
 }
 
+template <typename OperType>
+bool GcroDrSolver<OperType>::UpdateImage() const
+{
+  // C = M U, then C = Q R with U ← U R⁻¹ and C ← Q using the Cholesky factorization of the
+  // Gram matrix Cᴴ C.
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  const int k = static_cast<int>(U.size());
+  for (int i = 0; i < k; i++)
+  {
+    ApplyBA(pc_side, A, B, U[i], C[i], z, this->use_timer);
+  }
+  MatType G(k, k);
+  for (int j = 0; j < k; j++)
+  {
+    for (int i = 0; i < k; i++)
+    {
+      G(i, j) = linalg::LocalDot(C[j], C[i]);
+    }
+  }
+  Mpi::GlobalSum(k * k, G.data(), comm);
+  Eigen::LLT<MatType> llt(G);
+  if (llt.info() != Eigen::Success)
+  {
+    return false;
+  }
+  const MatType R = llt.matrixU();
+  const MatType R_inv =
+      R.template triangularView<Eigen::Upper>().solve(MatType::Identity(k, k));
+  for (auto *X : {&U, &C})
+  {
+    // In-place right multiplication by an upper triangular matrix, from the last column.
+    for (int j = k - 1; j >= 0; j--)
+    {
+      (*X)[j] *= R_inv(j, j);
+      for (int i = 0; i < j; i++)
+      {
+        (*X)[j].Add(R_inv(i, j), (*X)[i]);
+      }
+    }
+  }
+  return true;
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::ProjectResidual(VecType &x) const
+{
+  const int k = static_cast<int>(C.size());
+  if (k == 0)
+  {
+    return;
+  }
+  std::vector<ScalarType> c(k);
+  for (int i = 0; i < k; i++)
+  {
+    c[i] = linalg::LocalDot(r, C[i]);
+  }
+  Mpi::GlobalSum(k, c.data(), comm);
+  z = 0.0;
+  for (int i = 0; i < k; i++)
+  {
+    z.Add(c[i], U[i]);
+    r.Add(-c[i], C[i]);
+  }
+  if (!B || pc_side == PreconditionerSide::LEFT)
+  {
+    x += z;
+  }
+  else  // B && pc_side == PreconditionerSide::RIGHT
+  {
+    VecType &t = V[0];
+    ApplyB(B, z, t, this->use_timer);
+    x += t;
+  }
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::UpdateRecycleSpace(int m, const std::vector<ScalarType> &Hm,
+                                                const std::vector<ScalarType> &Bm) const
+{
+  // With Ũ = U D (unit columns), V̂ = [Ũ, Vₘ] and Ŵ = [C, Vₘ₊₁], we have M V̂ = Ŵ G for
+  // G = [D, Bₘ; 0, H̄ₘ]. The harmonic Ritz vectors solve Gᴴ G p = θ Gᴴ Ŵᴴ V̂ p, and the new
+  // recycled subspace is U = V̂ P R⁻¹, C = Ŵ Q, with G P = Q R.
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  const int k = static_cast<int>(U.size());
+  const int n = k + m;
+  const int k_new = std::min({max_recycle, max_dim - 1, n});
+  if (k_new < 1)
+  {
+    ClearRecycleSpace();
+    return;
+  }
+
+  // Assemble G and Ŵᴴ V̂, with one reduction for all required inner products.
+  std::vector<RealType> d(k);
+  MatType G = MatType::Zero(n + 1, n), WV = MatType::Zero(n + 1, n);
+  {
+    std::vector<ScalarType> dots(k * (k + m + 1) + k);
+    for (int j = 0; j < k; j++)
+    {
+      for (int i = 0; i < k; i++)
+      {
+        dots[j * (k + m + 1) + i] = linalg::LocalDot(U[j], C[i]);
+      }
+      for (int i = 0; i <= m; i++)
+      {
+        dots[j * (k + m + 1) + k + i] = linalg::LocalDot(U[j], V[i]);
+      }
+      dots[k * (k + m + 1) + j] = linalg::LocalDot(U[j], U[j]);
+    }
+    Mpi::GlobalSum(static_cast<int>(dots.size()), dots.data(), comm);
+    for (int j = 0; j < k; j++)
+    {
+      d[j] = 1.0 / std::sqrt(std::abs(dots[k * (k + m + 1) + j]));
+      G(j, j) = d[j];
+      for (int i = 0; i < k + m + 1; i++)
+      {
+        WV(i, j) = dots[j * (k + m + 1) + i] * d[j];
+      }
+    }
+  }
+  for (int j = 0; j < m; j++)
+  {
+    for (int i = 0; i < k; i++)
+    {
+      G(i, k + j) = Bm[j * k + i];
+    }
+    for (int i = 0; i <= j + 1; i++)
+    {
+      G(k + i, k + j) = Hm[j * (m + 1) + i];
+    }
+    WV(k + j, k + j) = 1.0;
+  }
+
+  // Solve the generalized eigenvalue problem, and select the eigenvectors corresponding to
+  // the eigenvalues of smallest magnitude (for real-valued problems, complex conjugate
+  // pairs contribute their real and imaginary parts).
+  const MatType GG = G.adjoint() * G, GW = G.adjoint() * WV;
+  Eigen::ComplexEigenSolver<Eigen::MatrixXcd> eig(
+      GW.template cast<std::complex<double>>().fullPivLu().solve(
+          GG.template cast<std::complex<double>>()));
+  if (eig.info() != Eigen::Success)
+  {
+    ClearRecycleSpace();
+    return;
+  }
+  std::vector<int> perm(n);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::sort(perm.begin(), perm.end(), [&eig](int i1, int i2)
+            { return std::abs(eig.eigenvalues()(i1)) < std::abs(eig.eigenvalues()(i2)); });
+  MatType P(n, k_new);
+  int p = 0;
+  if constexpr (std::is_same<ScalarType, RealType>::value)
+  {
+    constexpr double tol = 1.0e-10;
+    std::vector<std::complex<double>> used;
+    for (int i = 0; i < n && p < k_new; i++)
+    {
+      const auto lambda = eig.eigenvalues()(perm[i]);
+      const auto zi = eig.eigenvectors().col(perm[i]);
+      auto IsConjugate = [&](std::complex<double> l)
+      { return std::abs(lambda - std::conj(l)) <= tol * std::abs(lambda); };
+      if (std::any_of(used.begin(), used.end(), IsConjugate))
+      {
+        continue;
+      }
+      used.push_back(lambda);
+      P.col(p++) = zi.real();
+      if (zi.imag().norm() > tol * zi.norm() && p < k_new)
+      {
+        P.col(p++) = zi.imag();
+      }
+    }
+  }
+  else
+  {
+    for (; p < k_new; p++)
+    {
+      P.col(p) = eig.eigenvectors().col(perm[p]);
+    }
+  }
+  P.conservativeResize(n, p);
+
+  // QR factorization of G P.
+  Eigen::HouseholderQR<MatType> qr(G * P);
+  const MatType Q = qr.householderQ() * MatType::Identity(n + 1, p);
+  const MatType R = qr.matrixQR().topRows(p).template triangularView<Eigen::Upper>();
+  for (int i = 0; i < p; i++)
+  {
+    if (std::abs(R(i, i)) <= std::numeric_limits<double>::epsilon() * std::abs(R(0, 0)))
+    {
+      ClearRecycleSpace();
+      return;
+    }
+  }
+  const MatType PR = R.template triangularView<Eigen::Upper>()
+                         .template solve<Eigen::OnTheRight>(P);
+
+  // Form the new subspace vectors in the workspace, which is then swapped with U and C. The
+  // storage is reused across cycles, and is only allocated when the dimension of the
+  // recycled subspace changes.
+  U_work.resize(p);
+  C_work.resize(p);
+  for (int l = 0; l < p; l++)
+  {
+    for (auto *v : {&U_work[l], &C_work[l]})
+    {
+      v->SetSize(A->Height());
+      v->UseDevice(true);
+      *v = 0.0;
+    }
+    for (int j = 0; j < k; j++)
+    {
+      U_work[l].Add(PR(j, l) * d[j], U[j]);
+      C_work[l].Add(Q(j, l), C[j]);
+    }
+    for (int j = 0; j < m; j++)
+    {
+      U_work[l].Add(PR(k + j, l), V[j]);
+    }
+    for (int j = 0; j <= m; j++)
+    {
+      C_work[l].Add(Q(k + j, l), V[j]);
+    }
+  }
+  U.swap(U_work);
+  C.swap(C_work);
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  if (max_recycle < 1)
+  {
+    GmresSolver<OperType>::Mult(b, x);
+    return;
+  }
+
+  // Set up workspace.
+  RealType beta = 0.0, eps = 0.0;
+  MFEM_VERIFY(A, "Operator must be set for GcroDrSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for GcroDrSolver::Mult!");
+  r.SetSize(A->Height());
+  r.UseDevice(true);
+  z.SetSize(A->Height());
+  z.UseDevice(true);
+  this->Initialize();
+  MFEM_VERIFY(max_dim > 1, "GCRO-DR requires a restart dimension greater than 1!");
+  {
+    // Reserve the recycled subspace storage so it is never copied when resized.
+    const auto k_max = static_cast<std::size_t>(std::min(max_recycle, max_dim - 1));
+    for (auto *X : {&U, &C, &U_work, &C_work})
+    {
+      X->reserve(k_max);
+    }
+  }
+
+  // Update the recycled subspace for a new operator.
+  if (update_C && !U.empty() && !UpdateImage())
+  {
+    if (print_opts.warnings)
+    {
+      Mpi::Print(comm, "{}GCRO-DR recycled subspace is rank deficient and is discarded\n",
+                 std::string(tab_width, ' '));
+    }
+    ClearRecycleSpace();
+  }
+  update_C = false;
+
+  // Begin iterations.
+  converged = false;
+  int it = 0, restart = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for GCRO-DR solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  std::vector<ScalarType> Hm, Bm;
+  for (; it < max_it; restart++)
+  {
+    // Initialize, and deflate the recycled subspace from the residual.
+    InitialResidual(pc_side, A, B, b, x, r, z, (this->initial_guess || restart > 0),
+                    this->use_timer);
+    if (it == 0)
+    {
+      if (this->initial_guess)
+      {
+        RealType beta_rhs;
+        if (B && pc_side == PreconditionerSide::LEFT)
+        {
+          ApplyB(B, b, z, this->use_timer);
+          beta_rhs = linalg::Norml2(comm, z);
+        }
+        else  // !B || pc_side == PreconditionerSide::RIGHT
+        {
+          beta_rhs = linalg::Norml2(comm, b);
+        }
+        CheckDot(beta_rhs, "GCRO-DR residual norm is not valid: beta_rhs = ");
+        initial_res = beta_rhs;
+      }
+      else
+      {
+        initial_res = linalg::Norml2(comm, r);
+      }
+      eps = std::max(rel_tol * initial_res, abs_tol);
+    }
+    ProjectResidual(x);
+    beta = linalg::Norml2(comm, r);
+    CheckDot(beta, "GCRO-DR residual norm is not valid: beta = ");
+    if (beta < eps)
+    {
+      converged = true;
+      break;
+    }
+
+    // Arnoldi process for (I - C Cᴴ) M with the remaining subspace dimension.
+    const int k = static_cast<int>(C.size());
+    const int m_max = max_dim - k;
+    Hm.assign((m_max + 1) * m_max, 0.0);
+    Bm.assign(k * m_max, 0.0);
+    V[0] = 0.0;
+    V[0].Add(1.0 / beta, r);
+    std::fill(s.begin(), s.end(), 0.0);
+    s[0] = beta;
+
+    int j = 0;
+    for (;; j++, it++)
+    {
+      if (print_opts.iterations)
+      {
+        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+                   std::string(tab_width, ' '), it, int_width, restart, beta);
+      }
+      VecType &w = V[j + 1];
+      if (w.Size() == 0)
+      {
+        this->Update(j);
+      }
+      ApplyBA(pc_side, A, B, V[j], w, r, this->use_timer);
+      if (k > 0)
+      {
+        OrthogonalizeIteration(gs_orthog, comm, C, w, Bm.data() + j * k, k - 1);
+      }
+
+      ScalarType *Hj = H.data() + j * (max_dim + 1);
+      OrthogonalizeIteration(gs_orthog, comm, V, w, Hj, j);
+      Hj[j + 1] = linalg::Norml2(comm, w);
+      w *= 1.0 / Hj[j + 1];
+      std::copy(Hj, Hj + j + 2, Hm.begin() + j * (m_max + 1));
+
+      for (int l = 0; l < j; l++)
+      {
+        ApplyPlaneRotation(Hj[l], Hj[l + 1], cs[l], sn[l]);
+      }
+      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
+
+      beta = std::abs(s[j + 1]);
+      CheckDot(beta, "GCRO-DR residual norm is not valid: beta = ");
+      converged = (beta < eps);
+      if (converged || j + 1 == m_max || it + 1 == max_it)
+      {
+        it++;
+        break;
+      }
+    }
+
+    // Solve the projected least squares problem. The update is Vₘ y - U Bₘ y, which zeroes
+    // the component of the residual along C.
+    for (int i = j; i >= 0; i--)
+    {
+      ScalarType *Hi = H.data() + i * (max_dim + 1);
+      s[i] /= Hi[i];
+      for (int l = i - 1; l >= 0; l--)
+      {
+        s[l] -= Hi[l] * s[i];
+      }
+    }
+    r = 0.0;
+    for (int l = 0; l <= j; l++)
+    {
+      r.Add(s[l], V[l]);
+    }
+    for (int i = 0; i < k; i++)
+    {
+      ScalarType c = 0.0;
+      for (int l = 0; l <= j; l++)
+      {
+        c += Bm[l * k + i] * s[l];
+      }
+      r.Add(-c, U[i]);
+    }
+
+    // Extract the recycled subspace for subsequent cycles and solves before the Krylov
+    // basis is overwritten.
+    {
+      std::vector<ScalarType> Hm_j((j + 2) * (j + 1)), Bm_j(k * (j + 1));
+      for (int l = 0; l <= j; l++)
+      {
+        std::copy_n(Hm.begin() + l * (m_max + 1), j + 2, Hm_j.begin() + l * (j + 2));
+        std::copy_n(Bm.begin() + l * k, k, Bm_j.begin() + l * k);
+      }
+      UpdateRecycleSpace(j + 1, Hm_j, Bm_j);
+    }
+
+    // Update the solution.
+    if (!B || pc_side == PreconditionerSide::LEFT)
+    {
+      x += r;
+    }
+    else  // B && pc_side == PreconditionerSide::RIGHT
+    {
+      ApplyB(B, r, V[0], this->use_timer);
+      x += V[0];
+    }
+    if (converged)
+    {
+      break;
+    }
+  }
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, restart, beta);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}GCRO-DR solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e}, recycled dimension: {:d})\n",
+                 std::pow(beta / initial_res, 1.0 / it), U.size());
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = beta;
+  final_it = it;
+}
+
 template <typename OperType>
 void FgmresSolver<OperType>::Initialize() const
 {
@@ -860,6 +1715,8 @@ template class CgSolver<Operator>;
 template class CgSolver<ComplexOperator>;
 template class GmresSolver<Operator>;
 template class GmresSolver<ComplexOperator>;
+template class GcroDrSolver<Operator>;
+template class GcroDrSolver<ComplexOperator>;
 template class FgmresSolver<Operator>;
 template class FgmresSolver<ComplexOperator>;
 
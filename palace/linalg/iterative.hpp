@@ -137,10 +137,22 @@ protected:
   // Temporary workspace for solve.
   mutable VecType r, z, p;
 
+  // Single-vector PCG with the given initial guess flag and iteration limit.
+  void Solve(const VecType &b, VecType &x, bool guess, int max_iter) const;
+
 public:
   CgSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
 
   void Mult(const VecType &b, VecType &x) const override;
+
+  // Solve for multiple right-hand sides simultaneously using block PCG (D. P. O'Leary,
+  // Linear Algebra Appl. 1980). For real-valued systems, operator and preconditioner
+  // applications are batched over the block and all inner products for an iteration are
+  // formed as small Gram matrices with a single reduction. The search directions are kept
+  // orthonormal and numerically dependent ones are dropped (H. Ji and Y. Li, Numer.
+  // Algorithms 2017), so converged columns are deflated from the block without restarting
+  // the recurrence. Complex-valued systems are solved column by column.
+  void BlockMult(const mfem::Array<const VecType *> &b, mfem::Array<VecType *> &x) const;
 };
 
 // Preconditioned Generalized Minimum Residual Method (GMRES) for general nonsymmetric
@@ -210,6 +222,100 @@ public:
   void Mult(const VecType &b, VecType &x) const override;
 };
 
+// Preconditioned GMRES with deflated restarting and recycling of an approximate invariant
+// subspace across solves (GCRO-DR, M. L. Parks et al., SIAM J. Sci. Comput. 2006). The
+// harmonic Ritz vectors of smallest magnitude are extracted at the end of each cycle and
+// deflated from all subsequent cycles and solves, including solves with a modified operator
+// or preconditioner for a sequence of closely related systems.
+template <typename OperType>
+class GcroDrSolver : public GmresSolver<OperType>
+{
+protected:
+  using VecType = typename GmresSolver<OperType>::VecType;
+  using RealType = typename GmresSolver<OperType>::RealType;
+  using ScalarType = typename GmresSolver<OperType>::ScalarType;
+
+  using GmresSolver<OperType>::comm;
+  using GmresSolver<OperType>::print_opts;
+  using GmresSolver<OperType>::int_width;
+  using GmresSolver<OperType>::tab_width;
+
+  using GmresSolver<OperType>::rel_tol;
+  using GmresSolver<OperType>::abs_tol;
+  using GmresSolver<OperType>::max_it;
+
+  using GmresSolver<OperType>::A;
+  using GmresSolver<OperType>::B;
+
+  using GmresSolver<OperType>::converged;
+  using GmresSolver<OperType>::initial_res;
+  using GmresSolver<OperType>::final_res;
+  using GmresSolver<OperType>::final_it;
+
+  using GmresSolver<OperType>::max_dim;
+  using GmresSolver<OperType>::gs_orthog;
+  using GmresSolver<OperType>::pc_side;
+  using GmresSolver<OperType>::V;
+  using GmresSolver<OperType>::r;
+  using GmresSolver<OperType>::H;
+  using GmresSolver<OperType>::s;
+  using GmresSolver<OperType>::sn;
+  using GmresSolver<OperType>::cs;
+
+  // Maximum dimension of the recycled subspace.
+  int max_recycle;
+
+  // Recycled subspace U and its image C = M U under the preconditioned operator (M = BA
+  // or AB), with C orthonormal.
+  mutable std::vector<VecType> U, C;
+
+  // Workspace for updating the recycled subspace, swapped with U and C after each cycle.
+  mutable std::vector<VecType> U_work, C_work;
+
+  // Whether or not C must be recomputed for a new operator before the next solve.
+  mutable bool update_C;
+
+  // Temporary workspace for solve.
+  mutable VecType z;
+
+  // Recompute C = M U for the current operator and orthonormalize, returning false if the
+  // recycled subspace has become numerically rank deficient.
+  bool UpdateImage() const;
+
+  // Remove the component of the residual r in range(C) and add the corresponding correction
+  // to the solution: x += U Cᴴ r, r -= C Cᴴ r.
+  void ProjectResidual(VecType &x) const;
+
+  // Replace the recycled subspace with harmonic Ritz vectors for the cycle with m Arnoldi
+  // steps, given the unrotated Hessenberg matrix and the coefficients Cᴴ M V.
+  void UpdateRecycleSpace(int m, const std::vector<ScalarType> &Hm,
+                          const std::vector<ScalarType> &Bm) const;
+
+public:
+  GcroDrSolver(MPI_Comm comm, int print)
+    : GmresSolver<OperType>(comm, print), max_recycle(0), update_C(false)
+  {
+  }
+
+  // Set the maximum dimension of the recycled subspace.
+  void SetRecycleDim(int dim) { max_recycle = dim; }
+
+  // Discard the recycled subspace.
+  void ClearRecycleSpace() const
+  {
+    U.clear();
+    C.clear();
+  }
+
+  void SetOperator(const OperType &op) override
+  {
+    GmresSolver<OperType>::SetOperator(op);
+    update_C = true;
+  }
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
 // Preconditioned Flexible Generalized Minimum Residual Method (FGMRES) for general
 // nonsymmetric linear systems with a non-constant preconditioner.
 template <typename OperType>
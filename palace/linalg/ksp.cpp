@@ -36,6 +36,14 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(const IoData &i
       ksp = std::make_unique<CgSolver<OperType>>(comm, print);
       break;
     case KrylovSolver::GMRES:
+      if (iodata.solver.linear.recycle_size > 0)
+      {
+        auto gcrodr = std::make_unique<GcroDrSolver<OperType>>(comm, print);
+        gcrodr->SetRestartDim(iodata.solver.linear.max_size);
+        gcrodr->SetRecycleDim(iodata.solver.linear.recycle_size);
+        ksp = std::move(gcrodr);
+      }
+      else
       {
         auto gmres = std::make_unique<GmresSolver<OperType>>(comm, print);
         gmres->SetRestartDim(iodata.solver.linear.max_size);
@@ -264,6 +272,13 @@ void BaseKspSolver<OperType>::SetOperators(const OperType &op, const OperType &p
   }
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::SetOperator(const OperType &op)
+{
+  BlockTimer bt(Timer::KSP_SETUP, use_timer);
+  ksp->SetOperator(op);
+}
+
 template <typename OperType>
 void BaseKspSolver<OperType>::Mult(const VecType &x, VecType &y) const
 {
@@ -280,6 +295,32 @@ void BaseKspSolver<OperType>::Mult(const VecType &x, VecType &y) const
   ksp_mult_it += ksp->GetNumIterations();
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::BlockMult(const mfem::Array<const VecType *> &X,
+                                        mfem::Array<VecType *> &Y) const
+{
+  const auto *cg = dynamic_cast<const CgSolver<OperType> *>(ksp.get());
+  if (!cg)
+  {
+    for (int j = 0; j < X.Size(); j++)
+    {
+      Mult(*X[j], *Y[j]);
+    }
+    return;
+  }
+  BlockTimer bt(Timer::KSP, use_timer);
+  cg->BlockMult(X, Y);
+  if (!ksp->GetConverged())
+  {
+    Mpi::Warning(
+        ksp->GetComm(),
+        "Linear solver did not converge, norm(Ax-b)/norm(b) = {:.3e} (norm(b) = {:.3e})!\n",
+        ksp->GetFinalRes() / ksp->GetInitialRes(), ksp->GetInitialRes());
+  }
+  ksp_mult += X.Size();
+  ksp_mult_it += ksp->GetNumIterations();
+}
+
 template class BaseKspSolver<Operator>;
 template class BaseKspSolver<ComplexOperator>;
 
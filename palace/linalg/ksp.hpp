@@ -52,7 +52,15 @@ public:
 
   void SetOperators(const OperType &op, const OperType &pc_op);
 
+  // Update the operator for the Krylov solver only, keeping the current preconditioner
+  // (constructed for a nearby operator).
+  void SetOperator(const OperType &op);
+
   void Mult(const VecType &x, VecType &y) const;
+
+  // Solve with multiple right-hand sides. When the Krylov solver is CG, all columns are
+  // solved together with block PCG, otherwise they are solved one at a time.
+  void BlockMult(const mfem::Array<const VecType *> &X, mfem::Array<VecType *> &Y) const;
 };
 
 using KspSolver = BaseKspSolver<Operator>;
@@ -55,6 +55,54 @@ void ComplexOperator::AddMultHermitianTranspose(const ComplexVector &x, ComplexV
   MFEM_ABORT("Base class ComplexOperator does not implement AddMultHermitianTranspose!");
 }
 
+namespace
+{
+
+// Apply a real-valued operator to the two-column block [x0, x1] with a single call to the
+// multiple-vector interface, so operators which support it can share data access across
+// the columns.
+inline void BlockMult(const Operator &op, const Vector &x0, const Vector &x1, Vector &y0,
+                      Vector &y1)
+{
+  const Vector *X_[2] = {&x0, &x1};
+  Vector *Y_[2] = {&y0, &y1};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayMult(X, Y);
+}
+
+inline void BlockMultTranspose(const Operator &op, const Vector &x0, const Vector &x1,
+                               Vector &y0, Vector &y1)
+{
+  const Vector *X_[2] = {&x0, &x1};
+  Vector *Y_[2] = {&y0, &y1};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayMultTranspose(X, Y);
+}
+
+inline void BlockAddMult(const Operator &op, const Vector &x0, const Vector &x1, Vector &y0,
+                         Vector &y1, double a)
+{
+  const Vector *X_[2] = {&x0, &x1};
+  Vector *Y_[2] = {&y0, &y1};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayAddMult(X, Y, a);
+}
+
+inline void BlockAddMultTranspose(const Operator &op, const Vector &x0, const Vector &x1,
+                                  Vector &y0, Vector &y1, double a)
+{
+  const Vector *X_[2] = {&x0, &x1};
+  Vector *Y_[2] = {&y0, &y1};
+  const mfem::Array<const Vector *> X(X_, 2);
+  mfem::Array<Vector *> Y(Y_, 2);
+  op.ArrayAddMultTranspose(X, Y, a);
+}
+
+}  // namespace
+
 ComplexWrapperOperator::ComplexWrapperOperator(std::unique_ptr<Operator> &&dAr,
                                                std::unique_ptr<Operator> &&dAi,
                                                const Operator *pAr, const Operator *pAi)
@@ -97,23 +145,15 @@ void ComplexWrapperOperator::AssembleDiagonal(ComplexVector &diag) const
 
 void ComplexWrapperOperator::Mult(const ComplexVector &x, ComplexVector &y) const
 {
-  constexpr bool zero_real = false;
-  constexpr bool zero_imag = false;
   const Vector &xr = x.Real();
   const Vector &xi = x.Imag();
   Vector &yr = y.Real();
   Vector &yi = y.Imag();
   if (Ai)
   {
-    if (!zero_imag)
-    {
-      Ai->Mult(xi, yr);
-      yr *= -1.0;
-    }
-    if (!zero_real)
-    {
-      Ai->Mult(xr, yi);
-    }
+    // [yr, yi] = [-Ai xi, Ai xr].
+    BlockMult(*Ai, xi, xr, yr, yi);
+    yr *= -1.0;
   }
   else
   {
@@ -122,36 +162,21 @@ void ComplexWrapperOperator::Mult(const ComplexVector &x, ComplexVector &y) cons
   }
   if (Ar)
   {
-    if (!zero_real)
-    {
-      Ar->AddMult(xr, yr);
-    }
-    if (!zero_imag)
-    {
-      Ar->AddMult(xi, yi);
-    }
+    BlockAddMult(*Ar, xr, xi, yr, yi, 1.0);
   }
 }
 
 void ComplexWrapperOperator::MultTranspose(const ComplexVector &x, ComplexVector &y) const
 {
-  constexpr bool zero_real = false;
-  constexpr bool zero_imag = false;
   const Vector &xr = x.Real();
   const Vector &xi = x.Imag();
   Vector &yr = y.Real();
   Vector &yi = y.Imag();
   if (Ai)
   {
-    if (!zero_imag)
-    {
-      Ai->MultTranspose(xi, yr);
-      yr *= -1.0;
-    }
-    if (!zero_real)
-    {
-      Ai->MultTranspose(xr, yi);
-    }
+    // [yr, yi] = [-Aiᵀ xi, Aiᵀ xr].
+    BlockMultTranspose(*Ai, xi, xr, yr, yi);
+    yr *= -1.0;
   }
   else
   {
@@ -160,37 +185,22 @@ void ComplexWrapperOperator::MultTranspose(const ComplexVector &x, ComplexVector
   }
   if (Ar)
   {
-    if (!zero_real)
-    {
-      Ar->AddMultTranspose(xr, yr);
-    }
-    if (!zero_imag)
-    {
-      Ar->AddMultTranspose(xi, yi);
-    }
+    BlockAddMultTranspose(*Ar, xr, xi, yr, yi, 1.0);
   }
 }
 
 void ComplexWrapperOperator::MultHermitianTranspose(const ComplexVector &x,
                                                     ComplexVector &y) const
 {
-  constexpr bool zero_real = false;
-  constexpr bool zero_imag = false;
   const Vector &xr = x.Real();
   const Vector &xi = x.Imag();
   Vector &yr = y.Real();
   Vector &yi = y.Imag();
   if (Ai)
   {
-    if (!zero_imag)
-    {
-      Ai->MultTranspose(xi, yr);
-    }
-    if (!zero_real)
-    {
-      Ai->MultTranspose(xr, yi);
-      yi *= -1.0;
-    }
+    // [yr, yi] = [Aiᵀ xi, -Aiᵀ xr].
+    BlockMultTranspose(*Ai, xi, xr, yr, yi);
+    yi *= -1.0;
   }
   else
   {
@@ -199,14 +209,7 @@ void ComplexWrapperOperator::MultHermitianTranspose(const ComplexVector &x,
   }
   if (Ar)
   {
-    if (!zero_real)
-    {
-      Ar->AddMultTranspose(xr, yr);
-    }
-    if (!zero_imag)
-    {
-      Ar->AddMultTranspose(xi, yi);
-    }
+    BlockAddMultTranspose(*Ar, xr, xi, yr, yi, 1.0);
   }
 }
 
@@ -229,14 +232,7 @@ void ComplexWrapperOperator::AddMult(const ComplexVector &x, ComplexVector &y,
   {
     if (Ar)
     {
-      if (!zero_real)
-      {
-        Ar->AddMult(xr, yr, a.real());
-      }
-      if (!zero_imag)
-      {
-        Ar->AddMult(xi, yi, a.real());
-      }
+      BlockAddMult(*Ar, xr, xi, yr, yi, a.real());
     }
     if (Ai)
     {
@@ -296,14 +292,7 @@ void ComplexWrapperOperator::AddMultTranspose(const ComplexVector &x, ComplexVec
   {
     if (Ar)
     {
-      if (!zero_real)
-      {
-        Ar->AddMultTranspose(xr, yr, a.real());
-      }
-      if (!zero_imag)
-      {
-        Ar->AddMultTranspose(xi, yi, a.real());
-      }
+      BlockAddMultTranspose(*Ar, xr, xi, yr, yi, a.real());
     }
     if (Ai)
     {
@@ -364,14 +353,7 @@ void ComplexWrapperOperator::AddMultHermitianTranspose(const ComplexVector &x,
   {
     if (Ar)
     {
-      if (!zero_real)
-      {
-        Ar->AddMultTranspose(xr, yr, a.real());
-      }
-      if (!zero_imag)
-      {
-        Ar->AddMultTranspose(xi, yi, a.real());
-      }
+      BlockAddMultTranspose(*Ar, xr, xi, yr, yi, a.real());
     }
     if (Ai)
     {
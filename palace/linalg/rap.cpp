@@ -360,6 +360,189 @@ void ParOperator::AddMultTranspose(const Vector &x, Vector &y, const double a) c
   y.Add(a, tx);
 }
 
+void ParOperator::ArrayMult(const mfem::Array<const Vector *> &X,
+                            mfem::Array<Vector *> &Y) const
+{
+  MFEM_ASSERT(X.Size() == Y.Size(), "Incompatible block sizes for ParOperator::ArrayMult!");
+  if (RAP)
+  {
+    Operator::ArrayMult(X, Y);
+    return;
+  }
+  // Columns are applied in pairs using the two-column storage of the finite element
+  // spaces, with a trailing odd column applied on its own.
+  const int n = X.Size();
+  for (int j = 0; j + 1 < n; j += 2)
+  {
+    auto &ly = BlockLocalMult(*X[j], *X[j + 1]);
+    RestrictionMatrixMult(ly.Real(), *Y[j]);
+    RestrictionMatrixMult(ly.Imag(), *Y[j + 1]);
+    BlockEliminate(*X[j], *Y[j]);
+    BlockEliminate(*X[j + 1], *Y[j + 1]);
+  }
+  if (n % 2)
+  {
+    Mult(*X[n - 1], *Y[n - 1]);
+  }
+}
+
+void ParOperator::ArrayMultTranspose(const mfem::Array<const Vector *> &X,
+                                     mfem::Array<Vector *> &Y) const
+{
+  MFEM_ASSERT(X.Size() == Y.Size(),
+              "Incompatible block sizes for ParOperator::ArrayMultTranspose!");
+  if (RAP)
+  {
+    Operator::ArrayMultTranspose(X, Y);
+    return;
+  }
+  const int n = X.Size();
+  for (int j = 0; j + 1 < n; j += 2)
+  {
+    auto &lx = BlockLocalMultTranspose(*X[j], *X[j + 1]);
+    trial_fespace.GetProlongationMatrix()->MultTranspose(lx.Real(), *Y[j]);
+    trial_fespace.GetProlongationMatrix()->MultTranspose(lx.Imag(), *Y[j + 1]);
+    BlockEliminate(*X[j], *Y[j]);
+    BlockEliminate(*X[j + 1], *Y[j + 1]);
+  }
+  if (n % 2)
+  {
+    MultTranspose(*X[n - 1], *Y[n - 1]);
+  }
+}
+
+void ParOperator::ArrayAddMult(const mfem::Array<const Vector *> &X,
+                               mfem::Array<Vector *> &Y, const double a) const
+{
+  MFEM_ASSERT(X.Size() == Y.Size(),
+              "Incompatible block sizes for ParOperator::ArrayAddMult!");
+  if (RAP)
+  {
+    Operator::ArrayAddMult(X, Y, a);
+    return;
+  }
+  const int n = X.Size();
+  for (int j = 0; j + 1 < n; j += 2)
+  {
+    auto &ly = BlockLocalMult(*X[j], *X[j + 1]);
+    auto &ty = test_fespace.GetTVector<ComplexVector>();
+    RestrictionMatrixMult(ly.Real(), ty.Real());
+    RestrictionMatrixMult(ly.Imag(), ty.Imag());
+    BlockEliminate(*X[j], ty.Real());
+    BlockEliminate(*X[j + 1], ty.Imag());
+    Y[j]->Add(a, ty.Real());
+    Y[j + 1]->Add(a, ty.Imag());
+  }
+  if (n % 2)
+  {
+    AddMult(*X[n - 1], *Y[n - 1], a);
+  }
+}
+
+void ParOperator::ArrayAddMultTranspose(const mfem::Array<const Vector *> &X,
+                                        mfem::Array<Vector *> &Y, const double a) const
+{
+  MFEM_ASSERT(X.Size() == Y.Size(),
+              "Incompatible block sizes for ParOperator::ArrayAddMultTranspose!");
+  if (RAP)
+  {
+    Operator::ArrayAddMultTranspose(X, Y, a);
+    return;
+  }
+  const int n = X.Size();
+  for (int j = 0; j + 1 < n; j += 2)
+  {
+    auto &lx = BlockLocalMultTranspose(*X[j], *X[j + 1]);
+    auto &tx = trial_fespace.GetTVector<ComplexVector>();
+    trial_fespace.GetProlongationMatrix()->MultTranspose(lx.Real(), tx.Real());
+    trial_fespace.GetProlongationMatrix()->MultTranspose(lx.Imag(), tx.Imag());
+    BlockEliminate(*X[j], tx.Real());
+    BlockEliminate(*X[j + 1], tx.Imag());
+    Y[j]->Add(a, tx.Real());
+    Y[j + 1]->Add(a, tx.Imag());
+  }
+  if (n % 2)
+  {
+    AddMultTranspose(*X[n - 1], *Y[n - 1], a);
+  }
+}
+
+ComplexVector &ParOperator::BlockLocalMult(const Vector &x0, const Vector &x1) const
+{
+  MFEM_ASSERT(x0.Size() == width && x1.Size() == width,
+              "Incompatible dimensions for ParOperator::ArrayMult!");
+  auto &lx = trial_fespace.GetLVector<ComplexVector>();
+  auto &ly = (&trial_fespace == &test_fespace) ? trial_fespace.GetLVector2<ComplexVector>()
+                                               : test_fespace.GetLVector<ComplexVector>();
+  if (dbc_tdof_list.Size())
+  {
+    auto &tx = trial_fespace.GetTVector<ComplexVector>();
+    tx.Set(x0, x1);
+    linalg::SetSubVector(tx, dbc_tdof_list, 0.0);
+    trial_fespace.GetProlongationMatrix()->Mult(tx.Real(), lx.Real());
+    trial_fespace.GetProlongationMatrix()->Mult(tx.Imag(), lx.Imag());
+  }
+  else
+  {
+    trial_fespace.GetProlongationMatrix()->Mult(x0, lx.Real());
+    trial_fespace.GetProlongationMatrix()->Mult(x1, lx.Imag());
+  }
+
+  // Apply the operator on the L-vector block.
+  const Vector *LX_[2] = {&lx.Real(), &lx.Imag()};
+  Vector *LY_[2] = {&ly.Real(), &ly.Imag()};
+  const mfem::Array<const Vector *> LX(LX_, 2);
+  mfem::Array<Vector *> LY(LY_, 2);
+  A->ArrayMult(LX, LY);
+  return ly;
+}
+
+ComplexVector &ParOperator::BlockLocalMultTranspose(const Vector &x0,
+                                                    const Vector &x1) const
+{
+  MFEM_ASSERT(x0.Size() == height && x1.Size() == height,
+              "Incompatible dimensions for ParOperator::ArrayMultTranspose!");
+  auto &lx = trial_fespace.GetLVector<ComplexVector>();
+  auto &ly = (&trial_fespace == &test_fespace) ? trial_fespace.GetLVector2<ComplexVector>()
+                                               : test_fespace.GetLVector<ComplexVector>();
+  if (dbc_tdof_list.Size())
+  {
+    auto &ty = test_fespace.GetTVector<ComplexVector>();
+    ty.Set(x0, x1);
+    linalg::SetSubVector(ty, dbc_tdof_list, 0.0);
+    RestrictionMatrixMultTranspose(ty.Real(), ly.Real());
+    RestrictionMatrixMultTranspose(ty.Imag(), ly.Imag());
+  }
+  else
+  {
+    RestrictionMatrixMultTranspose(x0, ly.Real());
+    RestrictionMatrixMultTranspose(x1, ly.Imag());
+  }
+
+  // Apply the operator on the L-vector block.
+  const Vector *LY_[2] = {&ly.Real(), &ly.Imag()};
+  Vector *LX_[2] = {&lx.Real(), &lx.Imag()};
+  const mfem::Array<const Vector *> LY(LY_, 2);
+  mfem::Array<Vector *> LX(LX_, 2);
+  A->ArrayMultTranspose(LY, LX);
+  return lx;
+}
+
+void ParOperator::BlockEliminate(const Vector &x, Vector &y) const
+{
+  if (dbc_tdof_list.Size())
+  {
+    if (diag_policy == DiagonalPolicy::DIAG_ONE)
+    {
+      linalg::SetSubVector(y, dbc_tdof_list, x);
+    }
+    else if (diag_policy == DiagonalPolicy::DIAG_ZERO)
+    {
+      linalg::SetSubVector(y, dbc_tdof_list, 0.0);
+    }
+  }
+}
+
 void ParOperator::RestrictionMatrixMult(const Vector &ly, Vector &ty) const
 {
   if (!use_R)
@@ -47,6 +47,14 @@ private:
   void RestrictionMatrixMultTranspose(const Vector &ty, Vector &ly) const;
   Vector &GetTestLVector() const;
 
+  // Helper methods for two-column block application, using the real and imaginary parts of
+  // the complex-valued temporary storage of the finite element spaces as L-vectors. Return
+  // the output L-vector block (test space for BlockLocalMult, trial space for
+  // BlockLocalMultTranspose).
+  ComplexVector &BlockLocalMult(const Vector &x0, const Vector &x1) const;
+  ComplexVector &BlockLocalMultTranspose(const Vector &x0, const Vector &x1) const;
+  void BlockEliminate(const Vector &x, Vector &y) const;
+
   ParOperator(std::unique_ptr<Operator> &&dA, const Operator *pA,
               const FiniteElementSpace &trial_fespace,
               const FiniteElementSpace &test_fespace, bool test_restrict);
@@ -118,6 +126,22 @@ public:
   void AddMult(const Vector &x, Vector &y, const double a = 1.0) const override;
 
   void AddMultTranspose(const Vector &x, Vector &y, const double a = 1.0) const override;
+
+  // Multiple-vector operator application. Columns are processed in pairs (for example, the
+  // real and imaginary parts of a complex-valued vector) which share a single application
+  // of the local operator, limited by the two-column temporary storage of the finite
+  // element spaces. A trailing odd column is applied on its own.
+  void ArrayMult(const mfem::Array<const Vector *> &X,
+                 mfem::Array<Vector *> &Y) const override;
+
+  void ArrayMultTranspose(const mfem::Array<const Vector *> &X,
+                          mfem::Array<Vector *> &Y) const override;
+
+  void ArrayAddMult(const mfem::Array<const Vector *> &X, mfem::Array<Vector *> &Y,
+                    const double a = 1.0) const override;
+
+  void ArrayAddMultTranspose(const mfem::Array<const Vector *> &X, mfem::Array<Vector *> &Y,
+                             const double a = 1.0) const override;
 };
 
 // Complex-valued RAP operator.
@@ -71,8 +71,10 @@ inline PetscErrorCode FromPetscVec(Vec x, palace::ComplexVector &y1,
   return PETSC_SUCCESS;
 }
 
+// The conversions to PETSc vectors optionally scale the entries during the copy, to avoid
+// an extra pass over the data for the operator scalings.
 inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x, Vec y, int block = 0,
-                                 int nblocks = 1)
+                                 int nblocks = 1, double s = 1.0)
 {
   PetscInt n;
   PetscScalar *py;
@@ -81,13 +83,14 @@ inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x, Vec y, int bloc
   MFEM_ASSERT(x.Size() * nblocks == n,
               "Invalid size mismatch for PETSc vector conversion!");
   PetscCall(VecGetArrayWriteAndMemType(y, &py, &mtype));
-  x.Get(py + block * n / nblocks, n / nblocks, PetscMemTypeDevice(mtype));
+  x.Get(py + block * n / nblocks, n / nblocks, PetscMemTypeDevice(mtype), s);
   PetscCall(VecRestoreArrayWriteAndMemType(y, &py));
   return PETSC_SUCCESS;
 }
 
 inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x1,
-                                 const palace::ComplexVector &x2, Vec y)
+                                 const palace::ComplexVector &x2, Vec y, double s1 = 1.0,
+                                 double s2 = 1.0)
 {
   PetscInt n;
   PetscScalar *py;
@@ -96,8 +99,8 @@ inline PetscErrorCode ToPetscVec(const palace::ComplexVector &x1,
   MFEM_ASSERT(x1.Size() == n / 2 && x2.Size() == n / 2,
               "Invalid size mismatch for PETSc vector conversion!");
   PetscCall(VecGetArrayWriteAndMemType(y, &py, &mtype));
-  x1.Get(py, n / 2, PetscMemTypeDevice(mtype));
-  x2.Get(py + n / 2, n / 2, PetscMemTypeDevice(mtype));
+  x1.Get(py, n / 2, PetscMemTypeDevice(mtype), s1);
+  x2.Get(py + n / 2, n / 2, PetscMemTypeDevice(mtype), s2);
   PetscCall(VecRestoreArrayWriteAndMemType(y, &py));
   return PETSC_SUCCESS;
 }
@@ -1807,8 +1810,7 @@ PetscErrorCode __mat_apply_EPS_A0(Mat A, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opK->Mult(ctx->x1, ctx->y1);
-  ctx->y1 *= ctx->delta;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, 0, 1, ctx->delta));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1822,8 +1824,7 @@ PetscErrorCode __mat_apply_EPS_A1(Mat A, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opM->Mult(ctx->x1, ctx->y1);
-  ctx->y1 *= ctx->delta * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, 0, 1, ctx->delta * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1838,8 +1839,7 @@ PetscErrorCode __mat_apply_EPS_B(Mat A, Vec x, Vec y)
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opB->Mult(ctx->x1.Real(), ctx->y1.Real());
   ctx->opB->Mult(ctx->x1.Imag(), ctx->y1.Imag());
-  ctx->y1 *= ctx->delta * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, 0, 1, ctx->delta * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1856,21 +1856,14 @@ PetscErrorCode __pc_apply_EPS(PC pc, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opInv->Mult(ctx->x1, ctx->y1);
-  if (!ctx->sinvert)
-  {
-    ctx->y1 *= 1.0 / (ctx->delta * ctx->gamma);
-  }
-  else
-  {
-    ctx->y1 *= 1.0 / ctx->delta;
-  }
   if (ctx->opProj)
   {
     // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
     ctx->opProj->Mult(ctx->y1);
     // Mpi::Print(" After projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
   }
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, 0, 1,
+                       !ctx->sinvert ? 1.0 / (ctx->delta * ctx->gamma) : 1.0 / ctx->delta));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1884,7 +1877,6 @@ PetscErrorCode __mat_apply_PEPLinear_L0(Mat A, Vec x, Vec y)
   PetscCall(MatShellGetContext(A, (void **)&ctx));
   MFEM_VERIFY(ctx, "Invalid PETSc shell matrix context for SLEPc!");
   PetscCall(FromPetscVec(x, ctx->x1, ctx->x2));
-  ctx->y1 = ctx->x2;
   if (ctx->opC)
   {
     ctx->opC->Mult(ctx->x2, ctx->y2);
@@ -1895,8 +1887,7 @@ PetscErrorCode __mat_apply_PEPLinear_L0(Mat A, Vec x, Vec y)
   }
   ctx->y2 *= ctx->gamma;
   ctx->opK->AddMult(ctx->x1, ctx->y2, std::complex<double>(1.0, 0.0));
-  ctx->y2 *= -ctx->delta;
-  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y));
+  PetscCall(ToPetscVec(ctx->x2, ctx->y2, y, 1.0, -ctx->delta));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1911,10 +1902,8 @@ PetscErrorCode __mat_apply_PEPLinear_L1(Mat A, Vec x, Vec y)
   MFEM_VERIFY(ctx, "Invalid PETSc shell matrix context for SLEPc!");
 
   PetscCall(FromPetscVec(x, ctx->x1, ctx->x2));
-  ctx->y1 = ctx->x1;
   ctx->opM->Mult(ctx->x2, ctx->y2);
-  ctx->y2 *= ctx->delta * ctx->gamma * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y));
+  PetscCall(ToPetscVec(ctx->x1, ctx->y2, y, 1.0, ctx->delta * ctx->gamma * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1931,9 +1920,8 @@ PetscErrorCode __mat_apply_PEPLinear_B(Mat A, Vec x, Vec y)
   ctx->opB->Mult(ctx->x1.Imag(), ctx->y1.Imag());
   ctx->opB->Mult(ctx->x2.Real(), ctx->y2.Real());
   ctx->opB->Mult(ctx->x2.Imag(), ctx->y2.Imag());
-  ctx->y1 *= ctx->delta * ctx->gamma * ctx->gamma;
-  ctx->y2 *= ctx->delta * ctx->gamma * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y));
+  PetscCall(ToPetscVec(ctx->y1, ctx->y2, y, ctx->delta * ctx->gamma * ctx->gamma,
+                       ctx->delta * ctx->gamma * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -2056,8 +2044,7 @@ PetscErrorCode __mat_apply_PEP_B(Mat A, Vec x, Vec y)
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opB->Mult(ctx->x1.Real(), ctx->y1.Real());
   ctx->opB->Mult(ctx->x1.Imag(), ctx->y1.Imag());
-  ctx->y1 *= ctx->delta * ctx->gamma;
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, 0, 1, ctx->delta * ctx->gamma));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -2074,21 +2061,15 @@ PetscErrorCode __pc_apply_PEP(PC pc, Vec x, Vec y)
 
   PetscCall(FromPetscVec(x, ctx->x1));
   ctx->opInv->Mult(ctx->x1, ctx->y1);
-  if (!ctx->sinvert)
-  {
-    ctx->y1 *= 1.0 / (ctx->delta * ctx->gamma * ctx->gamma);
-  }
-  else
-  {
-    ctx->y1 *= 1.0 / ctx->delta;
-  }
   if (ctx->opProj)
   {
     // Mpi::Print(" Before projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
     ctx->opProj->Mult(ctx->y1);
     // Mpi::Print(" After projection: {:e}\n", linalg::Norml2(ctx->GetComm(), ctx->y1));
   }
-  PetscCall(ToPetscVec(ctx->y1, y));
+  PetscCall(ToPetscVec(ctx->y1, y, 0, 1,
+                       !ctx->sinvert ? 1.0 / (ctx->delta * ctx->gamma * ctx->gamma)
+                                     : 1.0 / ctx->delta));
 
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -7,7 +7,6 @@
 #include <random>
 #include <mfem/general/forall.hpp>
 #include "linalg/hypre.hpp"
-#include "utils/omp.hpp"
 
 namespace palace
 {
@@ -100,18 +99,11 @@ void ComplexVector::Set(const std::complex<double> *py, int size, bool on_dev)
   }
   else if (!on_dev)
   {
-    // Need copy from host to device (host pointer but using device).
-    Vector y(2 * size);
+    // Need copy from host to device (host pointer but using device). The interleaved host
+    // array is aliased directly so that it is transferred with a single copy, without any
+    // host staging buffer, and then split into real and imaginary parts on the device.
+    Vector y(reinterpret_cast<double *>(const_cast<std::complex<double> *>(py)), 2 * size);
     y.UseDevice(true);
-    {
-      auto *Y = y.HostWrite();
-      PalacePragmaOmp(parallel for schedule(static))
-      for (int i = 0; i < size; i++)
-      {
-        Y[2 * i] = py[i].real();
-        Y[2 * i + 1] = py[i].imag();
-      }
-    }
     SetImpl(y.Read(use_dev), size, use_dev);
   }
   else
@@ -121,19 +113,19 @@ void ComplexVector::Set(const std::complex<double> *py, int size, bool on_dev)
   }
 }
 
-void ComplexVector::Get(std::complex<double> *py, int size, bool on_dev) const
+void ComplexVector::Get(std::complex<double> *py, int size, bool on_dev, double s) const
 {
   MFEM_ASSERT(size == Size(),
               "Mismatch in dimension for array of std::complex<double> in ComplexVector!");
-  auto GetImpl = [this](double *Y, const int N, bool use_dev)
+  auto GetImpl = [this, s](double *Y, const int N, bool use_dev)
   {
     const auto *XR = Real().Read(use_dev);
     const auto *XI = Imag().Read(use_dev);
     mfem::forall_switch(use_dev, N,
                         [=] MFEM_HOST_DEVICE(int i)
                         {
-                          Y[2 * i] = XR[i];
-                          Y[2 * i + 1] = XI[i];
+                          Y[2 * i] = s * XR[i];
+                          Y[2 * i + 1] = s * XI[i];
                         });
   };
   const bool use_dev = UseDevice();
@@ -145,15 +137,14 @@ void ComplexVector::Get(std::complex<double> *py, int size, bool on_dev) const
   }
   else if (!on_dev)
   {
-    // Need copy from device to host (host pointer but using device).
-    const auto *XR = Real().HostRead();
-    const auto *XI = Imag().HostRead();
-    PalacePragmaOmp(parallel for schedule(static))
-    for (int i = 0; i < size; i++)
-    {
-      py[i].real(XR[i]);
-      py[i].imag(XI[i]);
-    }
+    // Need copy from device to host (host pointer but using device). Interleave on the
+    // device into a mirror of the host array, which is then transferred with a single copy
+    // directly into the output without touching the host copies of the real and imaginary
+    // parts.
+    Vector y(reinterpret_cast<double *>(py), 2 * size);
+    y.UseDevice(true);
+    GetImpl(y.Write(use_dev), size, use_dev);
+    y.HostRead();
   }
   else
   {
@@ -77,8 +77,9 @@ public:
   // Set from an array of complex values, without resizing.
   void Set(const std::complex<double> *py, int size, bool on_dev);
 
-  // Copy the vector into an array of complex values.
-  void Get(std::complex<double> *py, int size, bool on_dev) const;
+  // Copy the vector into an array of complex values, optionally scaling the entries by s
+  // during the copy.
+  void Get(std::complex<double> *py, int size, bool on_dev, double s = 1.0) const;
 
   // Set all entries equal to s.
   ComplexVector &operator=(std::complex<double> s);
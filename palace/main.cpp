@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 #include <thread>
 #include <chrono>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
 #include <mpi.h>
 #include <mfem.hpp>
+#include <nlohmann/json.hpp>
 #include "drivers/drivensolver.hpp"
 #include "drivers/eigensolver.hpp"
 #include "drivers/electrostaticsolver.hpp"
@@ -115,6 +117,40 @@ static void ConfigureCeedBackend(const std::string &ceed_backend)
   }
 }
 
+// Asynchronous field output performs collective communication on a background thread, and
+// needs MPI_THREAD_MULTIPLE. MPI is initialized before the configuration file is parsed, so
+// the single option is looked up directly in the configuration file, discarding all other
+// values while parsing. If this fails, for example for the trailing commas accepted by the
+// full configuration file parser, the fields are written synchronously.
+static bool UseAsyncWrite(const char *filename)
+{
+  std::ifstream fi(filename);
+  if (!fi.is_open())
+  {
+    return false;
+  }
+  constexpr std::string_view path[] = {"Problem", "OutputFormats", "AsyncWrite"};
+  auto filter = [&path](int depth, nlohmann::json::parse_event_t event,
+                        nlohmann::json &parsed)
+  {
+    return (event != nlohmann::json::parse_event_t::key || depth > 3 ||
+            (depth > 0 && parsed.get<std::string>() == path[depth - 1]));
+  };
+  try
+  {
+    constexpr bool allow_exceptions = true, ignore_comments = true;
+    const auto config =
+        nlohmann::json::parse(fi, filter, allow_exceptions, ignore_comments);
+    return config.value(nlohmann::json::json_pointer("/Problem/OutputFormats/AsyncWrite"),
+                        false);
+  }
+  catch (const std::exception &)
+  {
+    // Errors are reported when the configuration file is parsed after MPI initialization.
+    return false;
+  }
+}
+
 static void PrintPalaceBanner(MPI_Comm comm)
 {
   Mpi::Print(comm, "_____________     _______\n"
@@ -160,6 +196,10 @@ int main(int argc, char *argv[])
     (defined(STRUMPACK_USE_PTSCOTCH) || defined(STRUMPACK_USE_SLATE_SCALAPACK))
   Mpi::default_thread_required = MPI_THREAD_MULTIPLE;
 #endif
+  if (argc > 1 && UseAsyncWrite(argv[argc - 1]))
+  {
+    Mpi::default_thread_required = MPI_THREAD_MULTIPLE;
+  }
   Mpi::Init(argc, argv);
   MPI_Comm world_comm = Mpi::World();
   bool world_root = Mpi::Root(world_comm);
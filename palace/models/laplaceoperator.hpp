@@ -63,6 +63,9 @@ private:
   const auto &GetSources() const { return source_attr_lists; }
   const auto &GetBCValues() const { return dbc_values; }
 
+  // Return list of all Dirichlet boundary true dofs for all finite element space levels.
+  const std::vector<mfem::Array<int>> &GetDbcTDofLists() const { return dbc_tdof_lists; }
+
   // Return the parallel finite element space objects.
   auto &GetH1Spaces() { return h1_fespaces; }
   const auto &GetH1Spaces() const { return h1_fespaces; }
@@ -4,6 +4,7 @@
 #ifndef PALACE_MODELS_LUMPED_PORT_OPERATOR_HPP
 #define PALACE_MODELS_LUMPED_PORT_OPERATOR_HPP
 
+#include <cmath>
 #include <complex>
 #include <map>
 #include <memory>
@@ -78,6 +79,13 @@ public:
   std::complex<double> GetPower(GridFunction &E, GridFunction &B) const;
   std::complex<double> GetSParameter(GridFunction &E) const;
   std::complex<double> GetVoltage(GridFunction &E) const;
+
+  // The linear forms for the S-parameter and the voltage only differ by the factor 1 / √R
+  // for each element, so the S-parameter also follows from an already measured voltage.
+  std::complex<double> GetSParameter(std::complex<double> V) const
+  {
+    return (std::abs(R) > 0.0) ? V / std::sqrt(R) : 0.0;
+  }
 };
 
 //
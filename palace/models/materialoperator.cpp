@@ -385,6 +385,44 @@ mfem::Array<int> MaterialOperator::GetBdrAttributeToMaterial() const
   return bdr_attr_mat;
 }
 
+namespace
+{
+
+// If every material property is a multiple of the identity (to a relative tolerance, as
+// for material matching in Equals below), store the coefficient as scalar-valued, using
+// the mean of the diagonal. Operators assembled with a scalar coefficient then use the
+// isotropic code paths for the quadrature data, which avoid full tensor products with the
+// Jacobian at each quadrature point.
+void ReduceIsotropic(mfem::DenseTensor &mat_coeff)
+{
+  if (mat_coeff.SizeI() <= 1 || mat_coeff.SizeI() != mat_coeff.SizeJ())
+  {
+    return;
+  }
+  constexpr double tol = 1.0e-9;
+  const int n = mat_coeff.SizeI();
+  mfem::DenseTensor mat_coeff_scalar(1, 1, mat_coeff.SizeK());
+  for (int k = 0; k < mat_coeff.SizeK(); k++)
+  {
+    const double c = mat_coeff(k).Trace() / n;
+    const double tol_k = tol * mat_coeff(k).MaxMaxNorm();
+    for (int i = 0; i < n; i++)
+    {
+      for (int j = 0; j < n; j++)
+      {
+        if (std::abs(mat_coeff(i, j, k) - ((i == j) ? c : 0.0)) > tol_k)
+        {
+          return;
+        }
+      }
+    }
+    mat_coeff_scalar(0, 0, k) = c;
+  }
+  mat_coeff = mat_coeff_scalar;
+}
+
+}  // namespace
+
 MaterialPropertyCoefficient::MaterialPropertyCoefficient(int attr_max)
 {
   attr_mat.SetSize(attr_max);
@@ -395,6 +433,7 @@ MaterialPropertyCoefficient::MaterialPropertyCoefficient(
     const mfem::Array<int> &attr_mat_, const mfem::DenseTensor &mat_coeff_, double a)
   : attr_mat(attr_mat_), mat_coeff(mat_coeff_)
 {
+  ReduceIsotropic(mat_coeff);
   *this *= a;
 }
 
@@ -490,6 +529,11 @@ bool Equals(const mfem::DenseMatrix &mat_coeff, const mfem::DenseMatrix &coeff,
   {
     return Equals(mat_coeff, coeff(0, 0), a);
   }
+  else if (mat_coeff.Height() == 1 && mat_coeff.Width() == 1)
+  {
+    // Scalar (isotropic) material compared against a matrix-valued property.
+    return (a != 0.0 && Equals(coeff, mat_coeff(0, 0) / a, 1.0));
+  }
   else
   {
     constexpr double tol = 1.0e-9;
@@ -512,6 +556,7 @@ void MaterialPropertyCoefficient::AddCoefficient(const mfem::Array<int> &attr_ma
                 "MaterialPropertyCoefficient::AddCoefficient!");
     attr_mat = attr_mat_;
     mat_coeff = mat_coeff_;
+    ReduceIsotropic(mat_coeff);
     *this *= a;
   }
   else if (attr_mat_ == attr_mat)
@@ -665,7 +710,9 @@ void MaterialPropertyCoefficient::NormalProjectedCoefficient(const mfem::Vector
   mat_coeff.SetSize(1, 1, mat_coeff_backup.SizeK());
   for (int k = 0; k < mat_coeff.SizeK(); k++)
   {
-    mat_coeff(k) = mat_coeff_backup(k).InnerProduct(normal, normal);
+    mat_coeff(k) = (mat_coeff_backup.SizeI() == 1)
+                       ? mat_coeff_backup(0, 0, k) * (normal * normal)
+                       : mat_coeff_backup(k).InnerProduct(normal, normal);
   }
 }
 
@@ -126,8 +126,9 @@ public:
 
 //
 // Material property represented as a piecewise constant coefficient over domain or boundary
-// mesh elements. Can be scalar-valued or matrix-valued. This should probably always operate
-// at the level of libCEED attribute numbers (contiguous, 1-based) for consistency.
+// mesh elements. Can be scalar-valued or matrix-valued (matrix-valued properties which are
+// isotropic for all materials are stored as scalar-valued). This should probably always
+// operate at the level of libCEED attribute numbers (contiguous, 1-based) for consistency.
 //
 class MaterialPropertyCoefficient
 {
@@ -4,7 +4,12 @@
 #include "postoperator.hpp"
 
 #include <algorithm>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <limits>
 #include <string>
+#include <utility>
 #include "fem/coefficient.hpp"
 #include "fem/errorindicator.hpp"
 #include "models/curlcurloperator.hpp"
@@ -43,6 +48,38 @@ std::string OutputFolderName(const ProblemType solver_t)
   }
 }
 
+// Collectively write the local data from all processes contiguously, in rank order, to the
+// file at the given byte offset, which is then advanced past the global data.
+template <typename T>
+void WriteCollective(MPI_File fh, long long &seek, const std::vector<T> &data,
+                     MPI_Comm comm)
+{
+  long long n = static_cast<long long>(data.size()), offset = 0, total = n;
+  MPI_Exscan(&n, &offset, 1, MPI_LONG_LONG, MPI_SUM, comm);
+  if (Mpi::Root(comm))
+  {
+    offset = 0;  // MPI_Exscan result is undefined on the first process
+  }
+  Mpi::GlobalSum(1, &total, comm);
+  MPI_File_write_at_all(fh, static_cast<MPI_Offset>(seek + offset * sizeof(T)),
+                        data.data(), static_cast<int>(n), mpi::DataType<T>(),
+                        MPI_STATUS_IGNORE);
+  seek += total * static_cast<long long>(sizeof(T));
+}
+
+// Copy of a parallel mesh which uses the given communicator. The nonconforming mesh data,
+// when present, keeps the original communicator, but it is only used for communication
+// when the face neighbor data is exchanged during setup.
+class OutputParMesh : public mfem::ParMesh
+{
+public:
+  OutputParMesh(const mfem::ParMesh &mesh, MPI_Comm comm) : mfem::ParMesh(mesh)
+  {
+    MyComm = comm;
+    gtopo.SetComm(comm);
+  }
+};
+
 }  // namespace
 
 template <ProblemType solver_t>
@@ -109,6 +146,12 @@ PostOperator<solver_t>::PostOperator(const IoData &iodata, fem_op_t<solver_t> &f
   // Prepare for saving fields
   enable_paraview_output = iodata.problem.output_formats.paraview;
   enable_gridfunction_output = iodata.problem.output_formats.gridfunction;
+  enable_xdmf_output = iodata.problem.output_formats.xdmf;
+  output_precision = iodata.problem.output_formats.precision;
+#if defined(MFEM_USE_ZLIB)
+  output_compression = iodata.problem.output_formats.compression_level;
+#endif
+  output_fields = iodata.problem.output_formats.fields;
   if (solver_t == ProblemType::DRIVEN)
   {
     output_save_indices = iodata.solver.driven.save_indices;
@@ -129,11 +172,74 @@ PostOperator<solver_t>::PostOperator(const IoData &iodata, fem_op_t<solver_t> &f
   {
     output_delta_post = iodata.solver.transient.delta_post;
   }
+  if constexpr (solver_t == ProblemType::TRANSIENT)
+  {
+    // Storage for the running discrete Fourier transforms, for each excitation.
+    dft_omega = iodata.solver.transient.dft_f;
+    const std::size_t nf = dft_omega.size();
+    for (const auto &[ex_idx, ex_spec] : fem_op->GetPortExcitations())
+    {
+      auto &data = dft[ex_idx];
+      data.J.assign(nf, 0.0);
+      for (const auto &[idx, port] : fem_op->GetLumpedPortOp())
+      {
+        data.V[idx].assign(nf, 0.0);
+        data.I[idx].assign(nf, 0.0);
+        data.S[idx].assign(nf, 0.0);
+      }
+      if (iodata.solver.transient.dft_save_fields)
+      {
+        data.E.resize(nf);
+        data.B.resize(nf);
+        for (std::size_t k = 0; k < nf; k++)
+        {
+          data.E[k].SetSize(fem_op->GetNDSpace().GetTrueVSize());
+          data.E[k].UseDevice(true);
+          data.E[k] = 0.0;
+          data.B[k].SetSize(fem_op->GetRTSpace().GetTrueVSize());
+          data.B[k].UseDevice(true);
+          data.B[k] = 0.0;
+        }
+      }
+    }
+  }
 
   gridfunction_output_dir =
       (post_dir / "gridfunction" / OutputFolderName(solver_t)).string();
+  xdmf.output_dir = (post_dir / "xdmf" / OutputFolderName(solver_t)).string();
+  xdmf.precision = iodata.problem.output_formats.precision;
+  if constexpr (solver_t == ProblemType::TRANSIENT)
+  {
+    for (const auto &[ex_idx, ex_spec] : fem_op->GetPortExcitations())
+    {
+      const fs::path ex_folder = ExcitationFolderName(ex_idx);
+      if (!ex_folder.empty())
+      {
+        auto &data = xdmf_ex[ex_idx];
+        data.output_dir = (fs::path(xdmf.output_dir) / ex_folder).string();
+        data.precision = xdmf.precision;
+      }
+    }
+  }
 
-  SetupFieldCoefficients();
+  SetupFieldCoefficients(E.get(), B.get(), V.get(), A.get(), coeffs);
+  InitializeParaviewSnapshot(iodata);
+  if constexpr (solver_t == ProblemType::TRANSIENT)
+  {
+    // The data collections of each excitation persist over the whole simulation, so that
+    // each output step only appends to the existing files.
+    for (const auto &[ex_idx, ex_spec] : fem_op->GetPortExcitations())
+    {
+      const fs::path ex_folder = ExcitationFolderName(ex_idx);
+      if (!ex_folder.empty() && ShouldWriteParaviewFields())
+      {
+        InitializeParaviewDataCollection(ex_folder);
+        auto &data = paraview_ex[ex_idx];
+        data.paraview = std::move(paraview);
+        data.paraview_bdr = std::move(paraview_bdr);
+      }
+    }
+  }
   InitializeParaviewDataCollection();
 
   // Initialize CSV files for measurements.
@@ -236,16 +342,47 @@ void PostOperator<solver_t>::WriteParaviewFields(double time, int step)
 
   auto mesh_Lc0 = units.GetMeshLengthRelativeScale();
 
+  // With asynchronous output, the fields are first copied into the snapshot which the data
+  // collections are bound to.
+  if (paraview_snapshot)
+  {
+    UpdateParaviewSnapshot();
+  }
+  auto &E_o = paraview_snapshot ? paraview_snapshot->E : E;
+  auto &B_o = paraview_snapshot ? paraview_snapshot->B : B;
+  auto &V_o = paraview_snapshot ? paraview_snapshot->V : V;
+  auto &A_o = paraview_snapshot ? paraview_snapshot->A : A;
+
   // Given the electric field and magnetic flux density, write the fields to disk for
   // visualization. Write the mesh coordinates in the same units as originally input.
-  mfem::ParMesh &mesh = E ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
+  mfem::ParMesh &mesh =
+      E_o ? *E_o->ParFESpace()->GetParMesh() : *B_o->ParFESpace()->GetParMesh();
   mesh::DimensionalizeMesh(mesh, mesh_Lc0);
-  ScaleGridFunctions(mesh_Lc0, mesh.Dimension(), E, B, V, A);
-  DimensionalizeGridFunctions(units, E, B, V, A);
+  ScaleGridFunctions(mesh_Lc0, mesh.Dimension(), E_o, B_o, V_o, A_o);
+  DimensionalizeGridFunctions(units, E_o, B_o, V_o, A_o);
   paraview->SetCycle(step);
   paraview->SetTime(time);
   paraview_bdr->SetCycle(step);
   paraview_bdr->SetTime(time);
+  if (paraview_snapshot)
+  {
+    // All coefficients are evaluated on this thread: the domain fields derived from them
+    // are projected into the snapshot, and the boundary data collection, whose fields are
+    // all coefficient-derived, is saved synchronously (it is small compared to the domain
+    // one). The snapshot is then only accessed by the background thread until it is
+    // waited on. Its fields are overwritten before the next output, so only the mesh needs
+    // to be restored. The data collection is captured directly, since another
+    // excitation's may be swapped in before the write completes.
+    paraview_snapshot->ProjectFields();
+    paraview_bdr->Save();
+    paraview_io = std::async(std::launch::async,
+                             [pv = paraview.get(), &mesh, mesh_Lc0]()
+                             {
+                               pv->Save();
+                               mesh::NondimensionalizeMesh(mesh, mesh_Lc0);
+                             });
+    return;
+  }
   paraview->Save();
   paraview_bdr->Save();
   mesh::NondimensionalizeMesh(mesh, mesh_Lc0);
@@ -258,6 +395,7 @@ template <ProblemType solver_t>
 void PostOperator<solver_t>::WriteParaviewFieldsFinal(const ErrorIndicator *indicator)
 {
   BlockTimer bt(Timer::POSTPRO_PARAVIEW);
+  WaitForParaviewFields();
 
   auto mesh_Lc0 = units.GetMeshLengthRelativeScale();
 
@@ -265,7 +403,9 @@ void PostOperator<solver_t>::WriteParaviewFieldsFinal(const ErrorIndicator *indi
   // need for these to be parallel objects, since the data is local to each process and
   // there isn't a need to ever access the element neighbors. We set the time to some
   // non-used value to make the step identifiable within the data collection.
-  mfem::ParMesh &mesh = E ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
+  mfem::ParMesh &mesh = paraview_snapshot ? paraview_snapshot->mesh->Get()
+                        : E ? *E->ParFESpace()->GetParMesh()
+                            : *B->ParFESpace()->GetParMesh();
   mesh::DimensionalizeMesh(mesh, mesh_Lc0);
   paraview->SetCycle(paraview->GetCycle() + 1);
   if (paraview->GetTime() < 1.0)
@@ -369,7 +509,16 @@ void PostOperator<solver_t>::WriteMFEMGridFunctions(double time, int step)
     auto path = fs::path(gridfunction_output_dir) /
                 fmt::format("{}_{:0{}d}.gf.{:0{}d}", name, step, pad_digits_default,
                             local_rank, pad_digits_default);
-    std::ofstream file(path);
+    // Grid function files are only compressed for an explicit compression level, and keep
+    // the default stream precision unless double precision output is requested.
+    mfem::ofgzstream file(path.string(),
+                          (output_compression > 0)
+                              ? fmt::format("zwb{:d}", output_compression).c_str()
+                              : "w");
+    if (output_precision == 64)
+    {
+      file.precision(16);
+    }
     gridfunc.Save(file);
   };
 
@@ -377,7 +526,7 @@ void PostOperator<solver_t>::WriteMFEMGridFunctions(double time, int step)
   // Use 6-digit padding to match MFEM's pad_digits_default.
   if constexpr (HasEGridFunction<solver_t>())
   {
-    if (E)
+    if (E && IsOutputField("E"))
     {
       if constexpr (HasComplexGridFunction<solver_t>())
       {
@@ -395,7 +544,7 @@ void PostOperator<solver_t>::WriteMFEMGridFunctions(double time, int step)
 
   if constexpr (HasBGridFunction<solver_t>())
   {
-    if (B)
+    if (B && IsOutputField("B"))
     {
       if constexpr (HasComplexGridFunction<solver_t>())
       {
@@ -413,7 +562,7 @@ void PostOperator<solver_t>::WriteMFEMGridFunctions(double time, int step)
 
   if constexpr (HasVGridFunction<solver_t>())
   {
-    if (V)
+    if (V && IsOutputField("V"))
     {
       write_grid_function(V->Real(), "V");
     }
@@ -421,30 +570,30 @@ void PostOperator<solver_t>::WriteMFEMGridFunctions(double time, int step)
 
   if constexpr (HasAGridFunction<solver_t>())
   {
-    if (A)
+    if (A && IsOutputField("A"))
     {
       write_grid_function(A->Real(), "A");
     }
   }
 
-  if (U_e)
+  if (coeffs.U_e && IsOutputField("U_e"))
   {
     gridfunc_scalar = 0.0;
-    gridfunc_scalar.ProjectCoefficient(*U_e.get());
+    gridfunc_scalar.ProjectCoefficient(*coeffs.U_e.get());
     write_grid_function(gridfunc_scalar, "U_e");
   }
 
-  if (U_m)
+  if (coeffs.U_m && IsOutputField("U_m"))
   {
     gridfunc_scalar = 0.0;
-    gridfunc_scalar.ProjectCoefficient(*U_m.get());
+    gridfunc_scalar.ProjectCoefficient(*coeffs.U_m.get());
     write_grid_function(gridfunc_scalar, "U_m");
   }
 
-  if (S)
+  if (coeffs.S && IsOutputField("S"))
   {
     gridfunc_vector = 0.0;
-    gridfunc_vector.ProjectCoefficient(*S.get());
+    gridfunc_vector.ProjectCoefficient(*coeffs.S.get());
     write_grid_function(gridfunc_vector, "S");
   }
 
@@ -511,6 +660,316 @@ void PostOperator<solver_t>::WriteMFEMGridFunctionsFinal(const ErrorIndicator *i
   Mpi::Barrier(fem_op->GetComm());
 }
 
+template <ProblemType solver_t>
+void PostOperator<solver_t>::WriteXdmfFields(double time, int step)
+{
+  BlockTimer bt(Timer::POSTPRO_XDMF);
+
+  // Create output directory if it doesn't exist.
+  MPI_Comm comm = fem_op->GetComm();
+  if (Mpi::Root(comm))
+  {
+    fs::create_directories(xdmf.output_dir);
+  }
+  Mpi::Barrier(comm);
+
+  auto mesh_Lc0 = units.GetMeshLengthRelativeScale();
+
+  // Given the electric field and magnetic flux density, write the fields to disk for
+  // visualization. Write the mesh coordinates in the same units as originally input.
+  mfem::ParMesh &mesh = E ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
+  mesh::DimensionalizeMesh(mesh, mesh_Lc0);
+  ScaleGridFunctions(mesh_Lc0, mesh.Dimension(), E, B, V, A);
+  DimensionalizeGridFunctions(units, E, B, V, A);
+
+  // Fields are sampled at the vertices of each element, so the output is discontinuous
+  // across elements and the points are numbered consecutively element by element.
+  // Vector-valued quantities are always written with three components.
+  using Sampler = std::function<void(mfem::ElementTransformation &,
+                                     const mfem::IntegrationPoint &, mfem::Vector &)>;
+  std::vector<std::pair<XdmfFieldData, Sampler>> samplers;
+  auto add_field = [&samplers](const std::string &name, const mfem::ParGridFunction &gf)
+  {
+    samplers.push_back(
+        {{name, 3, 0}, [&gf](mfem::ElementTransformation &T,
+                             const mfem::IntegrationPoint &ip, mfem::Vector &v)
+         { gf.GetVectorValue(T, ip, v); }});
+  };
+  if constexpr (HasEGridFunction<solver_t>())
+  {
+    if (E && IsOutputField("E"))
+    {
+      if constexpr (HasComplexGridFunction<solver_t>())
+      {
+        add_field("E_real", E->Real());
+        add_field("E_imag", E->Imag());
+      }
+      else
+      {
+        add_field("E", E->Real());
+      }
+    }
+  }
+  if constexpr (HasBGridFunction<solver_t>())
+  {
+    if (B && IsOutputField("B"))
+    {
+      if constexpr (HasComplexGridFunction<solver_t>())
+      {
+        add_field("B_real", B->Real());
+        add_field("B_imag", B->Imag());
+      }
+      else
+      {
+        add_field("B", B->Real());
+      }
+    }
+  }
+  if constexpr (HasVGridFunction<solver_t>())
+  {
+    if (V && IsOutputField("V"))
+    {
+      samplers.push_back({{"V", 1, 0},
+                          [this](mfem::ElementTransformation &T,
+                                 const mfem::IntegrationPoint &ip, mfem::Vector &v)
+                          { v(0) = V->Real().GetValue(T, ip); }});
+    }
+  }
+  if constexpr (HasAGridFunction<solver_t>())
+  {
+    if (A && IsOutputField("A"))
+    {
+      add_field("A", A->Real());
+    }
+  }
+  auto add_coeff = [&samplers](const std::string &name, mfem::Coefficient &coeff)
+  {
+    samplers.push_back(
+        {{name, 1, 0}, [&coeff](mfem::ElementTransformation &T,
+                                const mfem::IntegrationPoint &ip, mfem::Vector &v)
+         { v(0) = coeff.Eval(T, ip); }});
+  };
+  if (coeffs.U_e && IsOutputField("U_e"))
+  {
+    add_coeff("U_e", *coeffs.U_e);
+  }
+  if (coeffs.U_m && IsOutputField("U_m"))
+  {
+    add_coeff("U_m", *coeffs.U_m);
+  }
+  if (coeffs.S && IsOutputField("S"))
+  {
+    samplers.push_back({{"S", 3, 0},
+                        [this](mfem::ElementTransformation &T,
+                               const mfem::IntegrationPoint &ip, mfem::Vector &v)
+                        { coeffs.S->Eval(v, T, ip); }});
+  }
+
+  // XDMF mixed topology element type identifiers.
+  auto xdmf_type = [](mfem::Geometry::Type geom) -> long long
+  {
+    switch (geom)
+    {
+      case mfem::Geometry::TRIANGLE:
+        return 4;
+      case mfem::Geometry::SQUARE:
+        return 5;
+      case mfem::Geometry::TETRAHEDRON:
+        return 6;
+      case mfem::Geometry::PYRAMID:
+        return 7;
+      case mfem::Geometry::PRISM:
+        return 8;
+      case mfem::Geometry::CUBE:
+        return 9;
+      default:
+        MFEM_ABORT("Unsupported element geometry for XDMF output!");
+        return 0;
+    }
+  };
+
+  long long num_pts = 0;
+  for (int i = 0; i < mesh.GetNE(); i++)
+  {
+    num_pts += mfem::Geometries.GetVertices(mesh.GetElementGeometry(i))->GetNPoints();
+  }
+  long long pt_offset = 0;
+  MPI_Exscan(&num_pts, &pt_offset, 1, MPI_LONG_LONG, MPI_SUM, comm);
+  if (Mpi::Root(comm))
+  {
+    pt_offset = 0;
+  }
+
+  std::vector<long long> topo;
+  std::vector<double> coords(3 * num_pts, 0.0);
+  std::vector<std::vector<double>> values(samplers.size());
+  for (std::size_t k = 0; k < samplers.size(); k++)
+  {
+    values[k].assign(samplers[k].first.num_comp * num_pts, 0.0);
+  }
+  topo.reserve(mesh.GetNE() + num_pts);
+  mfem::Vector x(mesh.SpaceDimension()), v;
+  for (int i = 0, p = 0; i < mesh.GetNE(); i++)
+  {
+    const mfem::Geometry::Type geom = mesh.GetElementGeometry(i);
+    const mfem::IntegrationRule &ir = *mfem::Geometries.GetVertices(geom);
+    mfem::ElementTransformation &T = *mesh.GetElementTransformation(i);
+    topo.push_back(xdmf_type(geom));
+    for (int j = 0; j < ir.GetNPoints(); j++)
+    {
+      // XDMF (VTK) wedges have the opposite orientation of the triangular faces compared
+      // to MFEM prisms.
+      constexpr int prism_perm[6] = {0, 2, 1, 3, 5, 4};
+      topo.push_back(pt_offset + p + ((geom == mfem::Geometry::PRISM) ? prism_perm[j] : j));
+    }
+    for (int j = 0; j < ir.GetNPoints(); j++, p++)
+    {
+      const mfem::IntegrationPoint &ip = ir.IntPoint(j);
+      T.SetIntPoint(&ip);
+      T.Transform(ip, x);
+      for (int d = 0; d < x.Size(); d++)
+      {
+        coords[3 * p + d] = x(d);
+      }
+      for (std::size_t k = 0; k < samplers.size(); k++)
+      {
+        const int num_comp = samplers[k].first.num_comp;
+        v.SetSize(num_comp);
+        v = 0.0;
+        samplers[k].second(T, ip, v);
+        for (int d = 0; d < std::min(num_comp, v.Size()); d++)
+        {
+          values[k][num_comp * p + d] = v(d);
+        }
+      }
+    }
+  }
+
+  auto write_real =
+      [this, comm](MPI_File fh, long long &seek, const std::vector<double> &data)
+  {
+    if (xdmf.precision == 32)
+    {
+      WriteCollective(fh, seek, std::vector<float>(data.begin(), data.end()), comm);
+    }
+    else
+    {
+      WriteCollective(fh, seek, data, comm);
+    }
+  };
+  auto open_file = [comm](const fs::path &path)
+  {
+    MPI_File fh;
+    int ret = MPI_File_open(comm, path.string().c_str(),
+                            MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
+    MFEM_VERIFY(ret == MPI_SUCCESS,
+                "Unable to open file " << path << " for XDMF output!");
+    MPI_File_set_size(fh, 0);
+    return fh;
+  };
+
+  // The mesh is written once, at the first output step.
+  if (xdmf.steps.empty())
+  {
+    MPI_File fh = open_file(fs::path(xdmf.output_dir) / "mesh.bin");
+    long long seek = 0;
+    WriteCollective(fh, seek, topo, comm);
+    xdmf.coords_seek = seek;
+    write_real(fh, seek, coords);
+    MPI_File_close(&fh);
+    xdmf.num_elem = mesh.GetNE();
+    xdmf.num_pts = num_pts;
+    xdmf.topo_size = static_cast<long long>(topo.size());
+    Mpi::GlobalSum(1, &xdmf.num_elem, comm);
+    Mpi::GlobalSum(1, &xdmf.num_pts, comm);
+    Mpi::GlobalSum(1, &xdmf.topo_size, comm);
+  }
+
+  // Write the fields for this step to a single file.
+  {
+    const auto filename = fmt::format("fields_{:0{}d}.bin", step, pad_digits_default);
+    MPI_File fh = open_file(fs::path(xdmf.output_dir) / filename);
+    long long seek = 0;
+    xdmf.fields.clear();
+    for (std::size_t k = 0; k < samplers.size(); k++)
+    {
+      xdmf.fields.push_back(samplers[k].first);
+      xdmf.fields.back().seek = seek;
+      write_real(fh, seek, values[k]);
+    }
+    MPI_File_close(&fh);
+  }
+  auto it = std::find_if(xdmf.steps.begin(), xdmf.steps.end(),
+                         [step](const auto &s) { return s.first == step; });
+  if (it != xdmf.steps.end())
+  {
+    it->second = time;
+  }
+  else
+  {
+    xdmf.steps.emplace_back(step, time);
+  }
+
+  // Rewrite the XDMF descriptor for the time series of steps written so far.
+  if (Mpi::Root(comm))
+  {
+    const int real_bytes = xdmf.precision / 8;
+    auto data_item = [](const std::string &dims, const char *type, int bytes,
+                        long long seek, const std::string &file)
+    {
+      return fmt::format(
+          "<DataItem Dimensions=\"{}\" NumberType=\"{}\" Precision=\"{:d}\" "
+          "Format=\"Binary\" Endian=\"Native\" Seek=\"{:d}\">{}</DataItem>",
+          dims, type, bytes, seek, file);
+    };
+    std::ofstream fo(fs::path(xdmf.output_dir) / (OutputFolderName(solver_t) + ".xdmf"));
+    fo << "<?xml version=\"1.0\" ?>\n"
+       << "<Xdmf Version=\"3.0\">\n"
+       << "  <Domain>\n"
+       << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" "
+          "CollectionType=\"Temporal\">\n";
+    for (const auto &[idx, t] : xdmf.steps)
+    {
+      fo << fmt::format("      <Grid Name=\"step_{:0{}d}\" GridType=\"Uniform\">\n", idx,
+                        pad_digits_default)
+         << fmt::format("        <Time Value=\"{:.12e}\"/>\n", t)
+         << fmt::format("        <Topology TopologyType=\"Mixed\" "
+                        "NumberOfElements=\"{:d}\">\n",
+                        xdmf.num_elem)
+         << "          "
+         << data_item(std::to_string(xdmf.topo_size), "Int", 8, 0, "mesh.bin") << "\n"
+         << "        </Topology>\n"
+         << "        <Geometry GeometryType=\"XYZ\">\n"
+         << "          "
+         << data_item(fmt::format("{:d} 3", xdmf.num_pts), "Float", real_bytes,
+                      xdmf.coords_seek, "mesh.bin")
+         << "\n"
+         << "        </Geometry>\n";
+      const auto filename = fmt::format("fields_{:0{}d}.bin", idx, pad_digits_default);
+      for (const auto &field : xdmf.fields)
+      {
+        fo << fmt::format("        <Attribute Name=\"{}\" AttributeType=\"{}\" "
+                          "Center=\"Node\">\n",
+                          field.name, (field.num_comp == 1) ? "Scalar" : "Vector")
+           << "          "
+           << data_item(fmt::format("{:d} {:d}", xdmf.num_pts, field.num_comp), "Float",
+                        real_bytes, field.seek, filename)
+           << "\n"
+           << "        </Attribute>\n";
+      }
+      fo << "      </Grid>\n";
+    }
+    fo << "    </Grid>\n"
+       << "  </Domain>\n"
+       << "</Xdmf>\n";
+  }
+
+  mesh::NondimensionalizeMesh(mesh, mesh_Lc0);
+  ScaleGridFunctions(1.0 / mesh_Lc0, mesh.Dimension(), E, B, V, A);
+  NondimensionalizeGridFunctions(units, E, B, V, A);
+  Mpi::Barrier(comm);
+}
+
 // Measurements.
 
 template <ProblemType solver_t>
@@ -896,6 +1355,60 @@ void PostOperator<solver_t>::MeasureProbes() const
 #endif
 }
 
+template <ProblemType solver_t>
+void PostOperator<solver_t>::MeasureSkipped() const
+{
+  // Entries keep their indices (and any static data) so that the output tables stay
+  // aligned with those from full measurements.
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  measurement_cache.domain_E_field_energy_all = nan;
+  measurement_cache.domain_H_field_energy_all = nan;
+  measurement_cache.domain_E_field_energy_i.clear();
+  measurement_cache.domain_H_field_energy_i.clear();
+  for (const auto &[idx, data] : dom_post_op.M_i)
+  {
+    measurement_cache.domain_E_field_energy_i.emplace_back(
+        Measurement::DomainData{idx, nan, nan});
+    measurement_cache.domain_H_field_energy_i.emplace_back(
+        Measurement::DomainData{idx, nan, nan});
+  }
+
+  measurement_cache.surface_flux_i.clear();
+  for (const auto &[idx, data] : surf_post_op.flux_surfs)
+  {
+    measurement_cache.surface_flux_i.emplace_back(
+        Measurement::FluxData{idx, std::complex<double>(nan, nan), data.type});
+  }
+
+  measurement_cache.interface_eps_i.clear();
+  if constexpr (HasEGridFunction<solver_t>())
+  {
+    for (const auto &[idx, data] : surf_post_op.eps_surfs)
+    {
+      measurement_cache.interface_eps_i.emplace_back(Measurement::InterfaceData{
+          idx, nan, surf_post_op.GetInterfaceLossTangent(idx), nan, nan});
+    }
+  }
+
+  measurement_cache.probe_E_field.clear();
+  measurement_cache.probe_B_field.clear();
+#if defined(MFEM_USE_GSLIB)
+  if (interp_op.GetProbes().size() > 0)
+  {
+    if constexpr (HasEGridFunction<solver_t>())
+    {
+      measurement_cache.probe_E_field.assign(
+          interp_op.GetProbes().size() * E->Real().VectorDim(), {nan, nan});
+    }
+    if constexpr (HasBGridFunction<solver_t>())
+    {
+      measurement_cache.probe_B_field.assign(
+          interp_op.GetProbes().size() * B->Real().VectorDim(), {nan, nan});
+    }
+  }
+#endif
+}
+
 using fmt::format;
 
 template <ProblemType solver_t>
@@ -907,6 +1420,7 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int ex_idx, int step,
     -> std::enable_if_t<U == ProblemType::DRIVEN, double>
 {
   BlockTimer bt0(Timer::POSTPRO);
+  WaitForParaviewFields();
   SetEGridFunction(e);
   SetBGridFunction(b);
 
@@ -935,6 +1449,15 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int ex_idx, int step,
     WriteMFEMGridFunctions(omega.real(), ind);
     Mpi::Print(" Wrote fields to disk (grid function) at step {:d}\n", step + 1);
   }
+  if (ShouldWriteXdmfFields(step))
+  {
+    Mpi::Print("\n");
+    auto ind = 1 + std::distance(output_save_indices.begin(),
+                                 std::lower_bound(output_save_indices.begin(),
+                                                  output_save_indices.end(), step));
+    WriteXdmfFields(omega.real(), ind);
+    Mpi::Print(" Wrote fields to disk (XDMF) at step {:d}\n", step + 1);
+  }
   return measurement_cache.domain_E_field_energy_all +
          measurement_cache.domain_H_field_energy_all;
 }
@@ -949,6 +1472,7 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int step, const ComplexVector &e
     -> std::enable_if_t<U == ProblemType::EIGENMODE, double>
 {
   BlockTimer bt0(Timer::POSTPRO);
+  WaitForParaviewFields();
   SetEGridFunction(e);
   SetBGridFunction(b);
 
@@ -991,6 +1515,11 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int step, const ComplexVector &e
     WriteMFEMGridFunctions(step, print_idx);
     Mpi::Print(" Wrote mode {:d} to disk (grid function)\n", print_idx);
   }
+  if (ShouldWriteXdmfFields(step))
+  {
+    WriteXdmfFields(step, print_idx);
+    Mpi::Print(" Wrote mode {:d} to disk (XDMF)\n", print_idx);
+  }
   return measurement_cache.domain_E_field_energy_all +
          measurement_cache.domain_H_field_energy_all;
 }
@@ -1002,6 +1531,7 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int step, const Vector &v, const
     -> std::enable_if_t<U == ProblemType::ELECTROSTATIC, double>
 {
   BlockTimer bt0(Timer::POSTPRO);
+  WaitForParaviewFields();
   SetVGridFunction(v);
   SetEGridFunction(e);
 
@@ -1022,6 +1552,12 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int step, const Vector &v, const
     WriteMFEMGridFunctions(step, idx);
     Mpi::Print(" Wrote fields to disk (grid function) for source {:d}\n", idx);
   }
+  if (ShouldWriteXdmfFields(step))
+  {
+    Mpi::Print("\n");
+    WriteXdmfFields(step, idx);
+    Mpi::Print(" Wrote fields to disk (XDMF) for source {:d}\n", idx);
+  }
   return measurement_cache.domain_E_field_energy_all +
          measurement_cache.domain_H_field_energy_all;
 }
@@ -1032,6 +1568,7 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int step, const Vector &a, const
     -> std::enable_if_t<U == ProblemType::MAGNETOSTATIC, double>
 {
   BlockTimer bt0(Timer::POSTPRO);
+  WaitForParaviewFields();
   SetAGridFunction(a);
   SetBGridFunction(b);
 
@@ -1052,40 +1589,95 @@ auto PostOperator<solver_t>::MeasureAndPrintAll(int step, const Vector &a, const
     WriteMFEMGridFunctions(step, idx);
     Mpi::Print(" Wrote fields to disk (grid function) for source {:d}\n", idx);
   }
+  if (ShouldWriteXdmfFields(step))
+  {
+    Mpi::Print("\n");
+    WriteXdmfFields(step, idx);
+    Mpi::Print(" Wrote fields to disk (XDMF) for source {:d}\n", idx);
+  }
   return measurement_cache.domain_E_field_energy_all +
          measurement_cache.domain_H_field_energy_all;
 }
 
 template <ProblemType solver_t>
 template <ProblemType U>
-auto PostOperator<solver_t>::MeasureAndPrintAll(int step, const Vector &e, const Vector &b,
-                                                double time, double J_coef)
+auto PostOperator<solver_t>::MeasureAndPrintAll(int ex_idx, int step, const Vector &e,
+                                                const Vector &b, double time,
+                                                double J_coef, bool measure_all)
     -> std::enable_if_t<U == ProblemType::TRANSIENT, double>
 {
   BlockTimer bt0(Timer::POSTPRO);
+  WaitForParaviewFields();
   SetEGridFunction(e);
   SetBGridFunction(b);
 
   measurement_cache = {};
+  measurement_cache.ex_idx = ex_idx;
   measurement_cache.Jcoeff_excitation = J_coef;
-  MeasureAllImpl();
+  if (measure_all)
+  {
+    MeasureAllImpl();
+  }
+  else
+  {
+    MeasureSkipped();
+    MeasureLumpedPorts();
+    MeasureWavePorts();
+  }
+  UpdateDFT(time, e, b);
 
   // Time must be converted before passing into csv due to the shared PrintAllCSVData
   // method.
   time = units.Dimensionalize<Units::ValueType::TIME>(time);
-  post_op_csv.PrintAllCSVData(*this, measurement_cache, time, step);
+  post_op_csv.PrintAllCSVData(*this, measurement_cache, time, step, ex_idx);
+
+  // With several excitations integrated together, the fields are written to a separate
+  // subfolder for each excitation, as for the driven solver. The field output is switched
+  // to the current excitation before writing.
+  const fs::path ex_folder = ExcitationFolderName(ex_idx);
   if (ShouldWriteParaviewFields(step))
   {
+    if (!ex_folder.empty())
+    {
+      auto &data = paraview_ex.at(ex_idx);
+      std::swap(paraview, data.paraview);
+      std::swap(paraview_bdr, data.paraview_bdr);
+    }
     Mpi::Print("\n");
     WriteParaviewFields(time, double(step) / output_delta_post);
     Mpi::Print(" Wrote fields to disk (Paraview) at step {:d}\n", step + 1);
+    if (!ex_folder.empty())
+    {
+      auto &data = paraview_ex.at(ex_idx);
+      std::swap(paraview, data.paraview);
+      std::swap(paraview_bdr, data.paraview_bdr);
+    }
   }
   if (ShouldWriteGridFunctionFields(step))
   {
+    if (!ex_folder.empty())
+    {
+      gridfunction_output_dir =
+          (post_dir / "gridfunction" / OutputFolderName(solver_t) / ex_folder).string();
+    }
     Mpi::Print("\n");
     WriteMFEMGridFunctions(time, double(step) / output_delta_post);
     Mpi::Print(" Wrote fields to disk (grid function) at step {:d}\n", step + 1);
   }
+  if (ShouldWriteXdmfFields(step))
+  {
+    if (!ex_folder.empty())
+    {
+      std::swap(xdmf, xdmf_ex.at(ex_idx));
+    }
+    Mpi::Print("\n");
+    WriteXdmfFields(time, double(step) / output_delta_post);
+    Mpi::Print(" Wrote fields to disk (XDMF) at step {:d}\n", step + 1);
+    if (!ex_folder.empty())
+    {
+      std::swap(xdmf, xdmf_ex.at(ex_idx));
+    }
+  }
   return measurement_cache.domain_E_field_energy_all +
          measurement_cache.domain_H_field_energy_all;
 }
@@ -1094,6 +1686,7 @@ template <ProblemType solver_t>
 void PostOperator<solver_t>::MeasureFinalize(const ErrorIndicator &indicator)
 {
   BlockTimer bt0(Timer::POSTPRO);
+  WaitForParaviewFields();
   auto indicator_stats = indicator.GetSummaryStatistics(fem_op->GetComm());
   post_op_csv.PrintErrorIndicator(Mpi::Root(fem_op->GetComm()), indicator_stats);
   if (ShouldWriteParaviewFields())
@@ -1104,6 +1697,268 @@ void PostOperator<solver_t>::MeasureFinalize(const ErrorIndicator &indicator)
   {
     WriteMFEMGridFunctionsFinal(&indicator);
   }
+  if constexpr (solver_t == ProblemType::TRANSIENT)
+  {
+    WriteDFT();
+  }
+}
+
+template <ProblemType solver_t>
+void PostOperator<solver_t>::UpdateDFT(double time, const Vector &e, const Vector &b)
+{
+  // Transform with the e^{-iωt} kernel, consistent with the e^{iωt} time dependence of the
+  // frequency domain solvers. The time step size is omitted since it cancels in the
+  // normalization by the transformed excitation.
+  if constexpr (solver_t == ProblemType::TRANSIENT)
+  {
+    if (dft_omega.empty())
+    {
+      return;
+    }
+    auto &data = dft.at(measurement_cache.ex_idx);
+    std::vector<std::complex<double>> phase(dft_omega.size());
+    for (std::size_t k = 0; k < dft_omega.size(); k++)
+    {
+      phase[k] = std::exp(std::complex<double>(0.0, -dft_omega[k] * time));
+      data.J[k] += measurement_cache.Jcoeff_excitation * phase[k];
+    }
+    for (const auto &[idx, port] : fem_op->GetLumpedPortOp())
+    {
+      // The mode projection follows from the port voltage measured for this step.
+      const auto &vi = measurement_cache.lumped_port_vi.at(idx);
+      const double S = port.GetSParameter(vi.V).real();
+      auto &V = data.V.at(idx);
+      auto &I = data.I.at(idx);
+      auto &P = data.S.at(idx);
+      for (std::size_t k = 0; k < dft_omega.size(); k++)
+      {
+        V[k] += vi.V.real() * phase[k];
+        I[k] += vi.I.real() * phase[k];
+        P[k] += S * phase[k];
+      }
+    }
+    for (std::size_t k = 0; k < data.E.size(); k++)
+    {
+      data.E[k].Real().Add(phase[k].real(), e);
+      data.E[k].Imag().Add(phase[k].imag(), e);
+      data.B[k].Real().Add(phase[k].real(), b);
+      data.B[k].Imag().Add(phase[k].imag(), b);
+    }
+  }
+}
+
+template <ProblemType solver_t>
+void PostOperator<solver_t>::WriteDFT()
+{
+  if constexpr (solver_t == ProblemType::TRANSIENT)
+  {
+    if (dft_omega.empty())
+    {
+      return;
+    }
+    const std::size_t nf = dft_omega.size();
+    const bool root = Mpi::Root(fem_op->GetComm());
+
+    // The S-parameters are only defined when the excitation drives a single lumped port,
+    // for which the normalized mode projection yields S + 1 (see MeasureSParameter). With
+    // several excitations, each one driving a single port gives a column of the S-matrix.
+    std::map<int, int> drive_port_idx;
+    for (const auto &[ex_idx, data] : dft)
+    {
+      int n_drive = 0;
+      for (const auto &[idx, port] : fem_op->GetLumpedPortOp())
+      {
+        if (port.HasExcitation() && port.excitation == ex_idx)
+        {
+          drive_port_idx[ex_idx] = idx;
+          n_drive++;
+        }
+      }
+      if (n_drive != 1)
+      {
+        drive_port_idx.erase(ex_idx);
+      }
+    }
+
+    // As for the driven solver, all excitations share the csv files and the columns are
+    // post-indexed by the excitation index when there are several.
+    auto ex_label = [multi_ex = (dft.size() > 1)](int ex_idx)
+    { return multi_ex ? fmt::format("[{}]", ex_idx) : std::string(); };
+    auto write_table = [&](const std::string &name, const std::vector<std::string> &labels,
+                           auto &&row)
+    {
+      if (!root)
+      {
+        return;
+      }
+      std::ofstream file(post_dir / name);
+      file << fmt::format("{:>15s}", "f (GHz)");
+      for (const auto &label : labels)
+      {
+        file << fmt::format(",{:>27s}", label);
+      }
+      file << '\n';
+      for (std::size_t k = 0; k < nf; k++)
+      {
+        file << fmt::format(
+            "{:>15.8e}", units.Dimensionalize<Units::ValueType::FREQUENCY>(dft_omega[k]));
+        for (double val : row(k))
+        {
+          file << fmt::format(",{:>+27.12e}", val);
+        }
+        file << '\n';
+      }
+    };
+    auto transfer = [](const TransientDFTData &data,
+                       const std::vector<std::complex<double>> &x, std::size_t k)
+    { return (std::abs(data.J[k]) > 0.0) ? x[k] / data.J[k] : 0.0; };
+
+    if (!dft.begin()->second.V.empty())
+    {
+      std::vector<std::string> labels_V, labels_I;
+      for (const auto &[ex_idx, data] : dft)
+      {
+        for (const auto &[idx, V] : data.V)
+        {
+          labels_V.push_back(fmt::format("Re{{V[{}]{}}} (V)", idx, ex_label(ex_idx)));
+          labels_V.push_back(fmt::format("Im{{V[{}]{}}} (V)", idx, ex_label(ex_idx)));
+          labels_I.push_back(fmt::format("Re{{I[{}]{}}} (A)", idx, ex_label(ex_idx)));
+          labels_I.push_back(fmt::format("Im{{I[{}]{}}} (A)", idx, ex_label(ex_idx)));
+        }
+      }
+      write_table("port-V-dft.csv", labels_V,
+                  [&](std::size_t k)
+                  {
+                    std::vector<double> vals;
+                    for (const auto &[ex_idx, data] : dft)
+                    {
+                      for (const auto &[idx, V] : data.V)
+                      {
+                        auto Vk = units.Dimensionalize<Units::ValueType::VOLTAGE>(
+                            transfer(data, V, k));
+                        vals.push_back(Vk.real());
+                        vals.push_back(Vk.imag());
+                      }
+                    }
+                    return vals;
+                  });
+      write_table("port-I-dft.csv", labels_I,
+                  [&](std::size_t k)
+                  {
+                    std::vector<double> vals;
+                    for (const auto &[ex_idx, data] : dft)
+                    {
+                      for (const auto &[idx, I] : data.I)
+                      {
+                        auto Ik = units.Dimensionalize<Units::ValueType::CURRENT>(
+                            transfer(data, I, k));
+                        vals.push_back(Ik.real());
+                        vals.push_back(Ik.imag());
+                      }
+                    }
+                    return vals;
+                  });
+    }
+
+    if (!drive_port_idx.empty())
+    {
+      std::vector<std::string> labels_S;
+      for (const auto &[ex_idx, j] : drive_port_idx)
+      {
+        for (const auto &[idx, S] : dft.at(ex_idx).S)
+        {
+          labels_S.push_back(fmt::format("|S[{}][{}]| (dB)", idx, j));
+          labels_S.push_back(fmt::format("arg(S[{}][{}]) (deg.)", idx, j));
+        }
+      }
+      write_table("port-S-dft.csv", labels_S,
+                  [&](std::size_t k)
+                  {
+                    std::vector<double> vals;
+                    for (const auto &[ex_idx, j] : drive_port_idx)
+                    {
+                      const auto &data = dft.at(ex_idx);
+                      const double drive_port_R = fem_op->GetLumpedPortOp().GetPort(j).R;
+                      for (const auto &[idx, S] : data.S)
+                      {
+                        auto Sk = transfer(data, S, k);
+                        if (idx == j)
+                        {
+                          Sk -= 1.0;
+                        }
+                        // Generalized S-parameters if the ports are resistive.
+                        const double R = fem_op->GetLumpedPortOp().GetPort(idx).R;
+                        if (std::abs(R) > 0.0)
+                        {
+                          Sk *= std::sqrt(drive_port_R / R);
+                        }
+                        vals.push_back(Measurement::Magnitude(Sk));
+                        vals.push_back(Measurement::Phase(Sk));
+                      }
+                    }
+                    return vals;
+                  });
+    }
+
+    // Write the transformed fields, normalized as the ports above, for visualization with
+    // ParaView. Each frequency is saved as a cycle of the data collection, with a separate
+    // subfolder for each excitation when there are several.
+    if (dft.begin()->second.E.empty() || !enable_paraview_output)
+    {
+      return;
+    }
+    BlockTimer bt(Timer::POSTPRO_PARAVIEW);
+    auto E_dft = std::make_unique<GridFunction>(fem_op->GetNDSpace(), true);
+    auto B_dft = std::make_unique<GridFunction>(fem_op->GetRTSpace(), true);
+    std::unique_ptr<GridFunction> V_dft, A_dft;
+    mfem::ParMesh &mesh = fem_op->GetNDSpace().GetParMesh();
+    const auto mesh_Lc0 = units.GetMeshLengthRelativeScale();
+    for (const auto &[ex_idx, data] : dft)
+    {
+      fs::path paraview_dir =
+          post_dir / "paraview" / fmt::format("{}_dft", OutputFolderName(solver_t));
+      const fs::path ex_folder = ExcitationFolderName(ex_idx);
+      if (!ex_folder.empty())
+      {
+        paraview_dir /= ex_folder;
+      }
+      mfem::ParaViewDataCollection paraview_dft(paraview_dir.string(), &mesh);
+      paraview_dft.SetDataFormat(mfem::VTKFormat::BINARY32);
+#if defined(MFEM_USE_ZLIB)
+      paraview_dft.SetCompressionLevel(-1);
+#endif
+      paraview_dft.SetHighOrderOutput(true);
+      paraview_dft.SetLevelsOfDetail(E_dft->ParFESpace()->GetMaxElementOrder());
+      paraview_dft.RegisterField("E_real", &E_dft->Real());
+      paraview_dft.RegisterField("E_imag", &E_dft->Imag());
+      paraview_dft.RegisterField("B_real", &B_dft->Real());
+      paraview_dft.RegisterField("B_imag", &B_dft->Imag());
+      for (std::size_t k = 0; k < nf; k++)
+      {
+        const std::complex<double> s =
+            (std::abs(data.J[k]) > 0.0) ? 1.0 / data.J[k] : std::complex<double>(0.0);
+        for (auto [x, gf] : {std::make_pair(&data.E[k], E_dft.get()),
+                             std::make_pair(&data.B[k], B_dft.get())})
+        {
+          ComplexVector y(*x);
+          y *= s;
+          gf->Real().SetFromTrueDofs(y.Real());
+          gf->Imag().SetFromTrueDofs(y.Imag());
+          gf->Real().ExchangeFaceNbrData();
+          gf->Imag().ExchangeFaceNbrData();
+        }
+        mesh::DimensionalizeMesh(mesh, mesh_Lc0);
+        ScaleGridFunctions(mesh_Lc0, mesh.Dimension(), E_dft, B_dft, V_dft, A_dft);
+        DimensionalizeGridFunctions(units, E_dft, B_dft, V_dft, A_dft);
+        paraview_dft.SetCycle(int(k));
+        paraview_dft.SetTime(
+            units.Dimensionalize<Units::ValueType::FREQUENCY>(dft_omega[k]));
+        paraview_dft.Save();
+        mesh::NondimensionalizeMesh(mesh, mesh_Lc0);
+      }
+    }
+    Mpi::Print(" Wrote transformed fields at {:d} frequencies to disk (ParaView)\n", nf);
+  }
 }
 
 template <ProblemType solver_t>
@@ -1112,6 +1967,23 @@ auto PostOperator<solver_t>::MeasureDomainFieldEnergyOnly(const ComplexVector &e
                                                           const ComplexVector &b)
     -> std::enable_if_t<U == ProblemType::DRIVEN, double>
 {
+  WaitForParaviewFields();
+  SetEGridFunction(e);
+  SetBGridFunction(b);
+  MeasureDomainFieldEnergy();
+  Mpi::Barrier(fem_op->GetComm());
+
+  // Return total domain energy for normalizing error indicator.
+  return measurement_cache.domain_E_field_energy_all +
+         measurement_cache.domain_H_field_energy_all;
+}
+
+template <ProblemType solver_t>
+template <ProblemType U>
+auto PostOperator<solver_t>::MeasureDomainFieldEnergyOnly(const Vector &e, const Vector &b)
+    -> std::enable_if_t<U == ProblemType::TRANSIENT, double>
+{
+  WaitForParaviewFields();
   SetEGridFunction(e);
   SetBGridFunction(b);
   MeasureDomainFieldEnergy();
@@ -1127,18 +1999,28 @@ template <ProblemType U>
 auto PostOperator<solver_t>::InitializeParaviewDataCollection(int ex_idx)
     -> std::enable_if_t<U == ProblemType::DRIVEN, void>
 {
-  fs::path sub_folder_name = "";
-  auto nr_excitations = fem_op->GetPortExcitations().Size();
-  if ((nr_excitations > 1) && (ex_idx > 0))
+  InitializeParaviewDataCollection(ExcitationFolderName(ex_idx));
+}
+
+template <ProblemType solver_t>
+fs::path PostOperator<solver_t>::ExcitationFolderName(int ex_idx) const
+{
+  if constexpr (solver_t == ProblemType::DRIVEN || solver_t == ProblemType::TRANSIENT)
   {
-    int spacing = 1 + int(std::log10(nr_excitations));
-    sub_folder_name = fmt::format(FMT_STRING("excitation_{:0>{}}"), ex_idx, spacing);
+    auto nr_excitations = fem_op->GetPortExcitations().Size();
+    if ((nr_excitations > 1) && (ex_idx > 0))
+    {
+      int spacing = 1 + int(std::log10(nr_excitations));
+      return fmt::format(FMT_STRING("excitation_{:0>{}}"), ex_idx, spacing);
+    }
   }
-  InitializeParaviewDataCollection(sub_folder_name);
+  return "";
 }
 
 template <ProblemType solver_t>
-void PostOperator<solver_t>::SetupFieldCoefficients()
+void PostOperator<solver_t>::SetupFieldCoefficients(GridFunction *E, GridFunction *B,
+                                                    GridFunction *V, GridFunction *A,
+                                                    FieldCoefficients &c) const
 {
   // We currently don't use the dependent grid functions apart from saving fields, so only
   // initialize if needed.
@@ -1150,12 +2032,12 @@ void PostOperator<solver_t>::SetupFieldCoefficients()
   // Set-up grid-functions for the paraview output / measurement.
   if constexpr (HasVGridFunction<solver_t>())
   {
-    V_s = std::make_unique<BdrFieldCoefficient>(V->Real());
+    c.V_s = std::make_unique<BdrFieldCoefficient>(V->Real());
   }
 
   if constexpr (HasAGridFunction<solver_t>())
   {
-    A_s = std::make_unique<BdrFieldVectorCoefficient>(A->Real());
+    c.A_s = std::make_unique<BdrFieldVectorCoefficient>(A->Real());
   }
 
   if constexpr (HasEGridFunction<solver_t>())
@@ -1171,19 +2053,19 @@ void PostOperator<solver_t>::SetupFieldCoefficients()
 
     // Electric Energy Density.
     // U_e = 1/2 Dᴴ E = 1/2 ε_0 Eᴴ E.
-    U_e = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::ELECTRIC>>(
+    c.U_e = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::ELECTRIC>>(
         *E, fem_op->GetMaterialOp(), scaling);
 
     // Electric Boundary Field & Surface Charge.
-    E_sr = std::make_unique<BdrFieldVectorCoefficient>(E->Real());
+    c.E_sr = std::make_unique<BdrFieldVectorCoefficient>(E->Real());
     // Q_s = D ⋅ n = ε_0 E ⋅ n.
-    Q_sr = std::make_unique<BdrSurfaceFluxCoefficient<SurfaceFlux::ELECTRIC>>(
+    c.Q_sr = std::make_unique<BdrSurfaceFluxCoefficient<SurfaceFlux::ELECTRIC>>(
         &E->Real(), nullptr, fem_op->GetMaterialOp(), true, mfem::Vector(), scaling);
 
     if constexpr (HasComplexGridFunction<solver_t>())
     {
-      E_si = std::make_unique<BdrFieldVectorCoefficient>(E->Imag());
-      Q_si = std::make_unique<BdrSurfaceFluxCoefficient<SurfaceFlux::ELECTRIC>>(
+      c.E_si = std::make_unique<BdrFieldVectorCoefficient>(E->Imag());
+      c.Q_si = std::make_unique<BdrSurfaceFluxCoefficient<SurfaceFlux::ELECTRIC>>(
           &E->Imag(), nullptr, fem_op->GetMaterialOp(), true, mfem::Vector(), scaling);
     }
   }
@@ -1201,19 +2083,19 @@ void PostOperator<solver_t>::SetupFieldCoefficients()
 
     // Magnetic Energy Density.
     // U_m = 1/2 Hᴴ B = 1/2 μ⁻¹ Bᴴ B.
-    U_m = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::MAGNETIC>>(
+    c.U_m = std::make_unique<EnergyDensityCoefficient<EnergyDensityType::MAGNETIC>>(
         *B, fem_op->GetMaterialOp(), scaling);
 
     // Magnetic Boundary Field & Surface Current.
-    B_sr = std::make_unique<BdrFieldVectorCoefficient>(B->Real());
+    c.B_sr = std::make_unique<BdrFieldVectorCoefficient>(B->Real());
     // J_s = n x H = n x μ⁻¹ B.
-    J_sr = std::make_unique<BdrSurfaceCurrentVectorCoefficient>(
+    c.J_sr = std::make_unique<BdrSurfaceCurrentVectorCoefficient>(
         B->Real(), fem_op->GetMaterialOp(), scaling);
 
     if constexpr (HasComplexGridFunction<solver_t>())
     {
-      B_si = std::make_unique<BdrFieldVectorCoefficient>(B->Imag());
-      J_si = std::make_unique<BdrSurfaceCurrentVectorCoefficient>(
+      c.B_si = std::make_unique<BdrFieldVectorCoefficient>(B->Imag());
+      c.J_si = std::make_unique<BdrSurfaceCurrentVectorCoefficient>(
           B->Imag(), fem_op->GetMaterialOp(), scaling);
     }
   }
@@ -1228,7 +2110,7 @@ void PostOperator<solver_t>::SetupFieldCoefficients()
     // E and B have been dimensionalized.
     const double scaling = units.Dimensionalize<Units::ValueType::FIELD_H>(1.0) /
                            units.Dimensionalize<Units::ValueType::FIELD_B>(1.0);
-    S = std::make_unique<PoyntingVectorCoefficient>(*E, *B, fem_op->GetMaterialOp(),
+    c.S = std::make_unique<PoyntingVectorCoefficient>(*E, *B, fem_op->GetMaterialOp(),
                                                     scaling);
   }
 }
@@ -1249,9 +2131,20 @@ void PostOperator<solver_t>::InitializeParaviewDataCollection(
     paraview_dir_v /= sub_folder_name;
     paraview_dir_b /= sub_folder_name;
   }
-  // Set up postprocessing for output to disk.
-  paraview = {paraview_dir_v.string(), &fem_op->GetNDSpace().GetParMesh()};
-  paraview_bdr = {paraview_dir_b.string(), &fem_op->GetNDSpace().GetParMesh()};
+  // Set up postprocessing for output to disk. With asynchronous output, the data
+  // collections are bound to the snapshot of the fields instead of the fields used by the
+  // solver.
+  WaitForParaviewFields();
+  mfem::ParMesh &mesh = paraview_snapshot ? paraview_snapshot->mesh->Get()
+                                          : fem_op->GetNDSpace().GetParMesh();
+  auto *E = paraview_snapshot ? paraview_snapshot->E.get() : this->E.get();
+  auto *B = paraview_snapshot ? paraview_snapshot->B.get() : this->B.get();
+  auto *V = paraview_snapshot ? paraview_snapshot->V.get() : this->V.get();
+  auto *A = paraview_snapshot ? paraview_snapshot->A.get() : this->A.get();
+  const auto &c = paraview_snapshot ? paraview_snapshot->coeffs : coeffs;
+  paraview = std::make_unique<mfem::ParaViewDataCollection>(paraview_dir_v.string(), &mesh);
+  paraview_bdr =
+      std::make_unique<mfem::ParaViewDataCollection>(paraview_dir_b.string(), &mesh);
 
   // make sure the folder can be created
   //bool bOk1 = fs::create_directories(paraview_dir_v.string());
@@ -1261,12 +2154,9 @@ void PostOperator<solver_t>::InitializeParaviewDataCollection(
   if (!bOk1 || !bOk2) { assert(0); return; }
 
 
-  const mfem::VTKFormat format = mfem::VTKFormat::BINARY32;
-#if defined(MFEM_USE_ZLIB)
-  const int compress = -1;  // Default compression level
-#else
-  const int compress = 0;
-#endif
+  const mfem::VTKFormat format =
+      (output_precision == 64) ? mfem::VTKFormat::BINARY : mfem::VTKFormat::BINARY32;
+  const int compress = output_compression;
   const bool use_ho = true;
   const int refine_ho = HasEGridFunction<solver_t>()
                             ? E->ParFESpace()->GetMaxElementOrder()
@@ -1291,98 +2181,232 @@ void PostOperator<solver_t>::InitializeParaviewDataCollection(
   // boundaries. For internal boundary surfaces, this takes the field evaluated in the
   // neighboring element with the larger dielectric permittivity or magnetic
   // permeability.
-  if (E)
+  if (E && IsOutputField("E"))
   {
     if (HasComplexGridFunction<solver_t>())
     {
       paraview->RegisterField("E_real", &E->Real());
       paraview->RegisterField("E_imag", &E->Imag());
-      paraview_bdr->RegisterVCoeffField("E_real", E_sr.get());
-      paraview_bdr->RegisterVCoeffField("E_imag", E_si.get());
+      paraview_bdr->RegisterVCoeffField("E_real", c.E_sr.get());
+      paraview_bdr->RegisterVCoeffField("E_imag", c.E_si.get());
     }
     else
     {
       paraview->RegisterField("E", &E->Real());
-      paraview_bdr->RegisterVCoeffField("E", E_sr.get());
+      paraview_bdr->RegisterVCoeffField("E", c.E_sr.get());
     }
   }
-  if (B)
+  if (B && IsOutputField("B"))
   {
     if (HasComplexGridFunction<solver_t>())
     {
       paraview->RegisterField("B_real", &B->Real());
       paraview->RegisterField("B_imag", &B->Imag());
-      paraview_bdr->RegisterVCoeffField("B_real", B_sr.get());
-      paraview_bdr->RegisterVCoeffField("B_imag", B_si.get());
+      paraview_bdr->RegisterVCoeffField("B_real", c.B_sr.get());
+      paraview_bdr->RegisterVCoeffField("B_imag", c.B_si.get());
     }
     else
     {
       paraview->RegisterField("B", &B->Real());
-      paraview_bdr->RegisterVCoeffField("B", B_sr.get());
+      paraview_bdr->RegisterVCoeffField("B", c.B_sr.get());
     }
   }
-  if (V)
+  if (V && IsOutputField("V"))
   {
     paraview->RegisterField("V", &V->Real());
-    paraview_bdr->RegisterCoeffField("V", V_s.get());
+    paraview_bdr->RegisterCoeffField("V", c.V_s.get());
   }
-  if (A)
+  if (A && IsOutputField("A"))
   {
     paraview->RegisterField("A", &A->Real());
-    paraview_bdr->RegisterVCoeffField("A", A_s.get());
+    paraview_bdr->RegisterVCoeffField("A", c.A_s.get());
   }
 
   // Extract energy density field for electric field energy 1/2 Dᴴ E or magnetic field
   // energy 1/2 Hᴴ B. Also Poynting vector S = E x H⋆.
-  if (U_e)
+  // With asynchronous output, the domain fields are registered as their projections.
+  if (c.U_e && IsOutputField("U_e"))
   {
-    paraview->RegisterCoeffField("U_e", U_e.get());
-    paraview_bdr->RegisterCoeffField("U_e", U_e.get());
+    if (paraview_snapshot)
+    {
+      paraview->RegisterField("U_e", paraview_snapshot->GetProjectedField(c.U_e.get()));
+    }
+    else
+    {
+      paraview->RegisterCoeffField("U_e", c.U_e.get());
+    }
+    paraview_bdr->RegisterCoeffField("U_e", c.U_e.get());
   }
-  if (U_m)
+  if (c.U_m && IsOutputField("U_m"))
   {
-    paraview->RegisterCoeffField("U_m", U_m.get());
-    paraview_bdr->RegisterCoeffField("U_m", U_m.get());
+    if (paraview_snapshot)
+    {
+      paraview->RegisterField("U_m", paraview_snapshot->GetProjectedField(c.U_m.get()));
+    }
+    else
+    {
+      paraview->RegisterCoeffField("U_m", c.U_m.get());
+    }
+    paraview_bdr->RegisterCoeffField("U_m", c.U_m.get());
   }
-  if (S)
+  if (c.S && IsOutputField("S"))
   {
-    paraview->RegisterVCoeffField("S", S.get());
-    paraview_bdr->RegisterVCoeffField("S", S.get());
+    if (paraview_snapshot)
+    {
+      paraview->RegisterField("S", paraview_snapshot->GetProjectedField(c.S.get()));
+    }
+    else
+    {
+      paraview->RegisterVCoeffField("S", c.S.get());
+    }
+    paraview_bdr->RegisterVCoeffField("S", c.S.get());
   }
 
   // Extract surface charge from normally discontinuous ND E-field. Also extract surface
   // currents from tangentially discontinuous RT B-field The surface charge and surface
   // currents are single-valued at internal boundaries.
-  if (Q_sr)
+  if (c.Q_sr && IsOutputField("Q_s"))
   {
     if (HasComplexGridFunction<solver_t>())
     {
-      paraview_bdr->RegisterCoeffField("Q_s_real", Q_sr.get());
-      paraview_bdr->RegisterCoeffField("Q_s_imag", Q_si.get());
+      paraview_bdr->RegisterCoeffField("Q_s_real", c.Q_sr.get());
+      paraview_bdr->RegisterCoeffField("Q_s_imag", c.Q_si.get());
     }
     else
     {
-      paraview_bdr->RegisterCoeffField("Q_s", Q_sr.get());
+      paraview_bdr->RegisterCoeffField("Q_s", c.Q_sr.get());
     }
   }
-  if (J_sr)
+  if (c.J_sr && IsOutputField("J_s"))
   {
     if (HasComplexGridFunction<solver_t>())
     {
-      paraview_bdr->RegisterVCoeffField("J_s_real", J_sr.get());
-      paraview_bdr->RegisterVCoeffField("J_s_imag", J_si.get());
+      paraview_bdr->RegisterVCoeffField("J_s_real", c.J_sr.get());
+      paraview_bdr->RegisterVCoeffField("J_s_imag", c.J_si.get());
     }
     else
     {
-      paraview_bdr->RegisterVCoeffField("J_s", J_sr.get());
+      paraview_bdr->RegisterVCoeffField("J_s", c.J_sr.get());
     }
   }
 
   // Add wave port boundary mode postprocessing when available.
-  for (const auto &[idx, data] : port_E0)
+  if (IsOutputField("E0"))
   {
-    paraview_bdr->RegisterVCoeffField(fmt::format("E0_{}_real", idx), data.E0r.get());
-    paraview_bdr->RegisterVCoeffField(fmt::format("E0_{}_imag", idx), data.E0i.get());
+    for (const auto &[idx, data] : port_E0)
+    {
+      paraview_bdr->RegisterVCoeffField(fmt::format("E0_{}_real", idx), data.E0r.get());
+      paraview_bdr->RegisterVCoeffField(fmt::format("E0_{}_imag", idx), data.E0i.get());
+    }
+  }
+}
+
+template <ProblemType solver_t>
+void PostOperator<solver_t>::InitializeParaviewSnapshot(const IoData &iodata)
+{
+  if (!iodata.problem.output_formats.async_write || !ShouldWriteParaviewFields())
+  {
+    return;
+  }
+
+  // The background thread performs collective communication when saving the data
+  // collections, and the wave port mode fields are updated by the solver between writes.
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided < MPI_THREAD_MULTIPLE || !port_E0.empty())
+  {
+    Mpi::Warning(fem_op->GetComm(),
+                 "Asynchronous field output requires MPI_THREAD_MULTIPLE support and is "
+                 "not available with wave ports, writing fields synchronously!\n");
+    return;
+  }
+
+  // Copy the mesh onto a duplicated communicator, so that the collective communication of
+  // the background thread never matches that of the solver, and construct the snapshot
+  // fields on matching finite element spaces with the face neighbor data allocated for the
+  // boundary field coefficients.
+  paraview_snapshot = std::make_unique<ParaviewSnapshot>();
+  auto &snap = *paraview_snapshot;
+  MPI_Comm_dup(fem_op->GetComm(), &snap.comm);
+  snap.mesh = std::make_unique<Mesh>(
+      std::make_unique<OutputParMesh>(fem_op->GetNDSpace().GetParMesh(), snap.comm));
+  auto MakeSnapshotField =
+      [&snap](const std::unique_ptr<GridFunction> &gf, const FiniteElementSpace &fespace)
+  {
+    if (!gf)
+    {
+      return std::unique_ptr<GridFunction>();
+    }
+    auto &snap_fespace = snap.fespaces.emplace_back(
+        std::make_unique<FiniteElementSpace>(*snap.mesh, &fespace.GetFEColl()));
+    auto snap_gf = std::make_unique<GridFunction>(*snap_fespace, gf->HasImag());
+    snap_gf->Real().ExchangeFaceNbrData();
+    if (snap_gf->HasImag())
+    {
+      snap_gf->Imag().ExchangeFaceNbrData();
+    }
+    return snap_gf;
+  };
+  if constexpr (HasEGridFunction<solver_t>())
+  {
+    snap.E = MakeSnapshotField(E, fem_op->GetNDSpace());
+  }
+  if constexpr (HasBGridFunction<solver_t>())
+  {
+    snap.B = MakeSnapshotField(B, fem_op->GetRTSpace());
+  }
+  if constexpr (HasVGridFunction<solver_t>())
+  {
+    snap.V = MakeSnapshotField(V, fem_op->GetH1Space());
+  }
+  if constexpr (HasAGridFunction<solver_t>())
+  {
+    snap.A = MakeSnapshotField(A, fem_op->GetNDSpace());
+  }
+  SetupFieldCoefficients(snap.E.get(), snap.B.get(), snap.V.get(), snap.A.get(),
+                         snap.coeffs);
+  const int order = snap.E ? snap.E->ParFESpace()->GetMaxElementOrder()
+                           : snap.B->ParFESpace()->GetMaxElementOrder();
+  auto &snap_mesh = snap.mesh->Get();
+  snap.l2_fec = std::make_unique<mfem::L2_FECollection>(order, snap_mesh.Dimension());
+  snap.l2_fespace = std::make_unique<mfem::ParFiniteElementSpace>(&snap_mesh,
+                                                                  snap.l2_fec.get());
+  snap.l2_vfespace = std::make_unique<mfem::ParFiniteElementSpace>(
+      &snap_mesh, snap.l2_fec.get(), snap_mesh.SpaceDimension());
+}
+
+template <ProblemType solver_t>
+void PostOperator<solver_t>::UpdateParaviewSnapshot()
+{
+  WaitForParaviewFields();
+  auto &snap = *paraview_snapshot;
+  for (auto [gf, snap_gf] : {std::make_pair(E.get(), snap.E.get()),
+                             std::make_pair(B.get(), snap.B.get()),
+                             std::make_pair(V.get(), snap.V.get()),
+                             std::make_pair(A.get(), snap.A.get())})
+  {
+    if (!gf)
+    {
+      continue;
+    }
+    static_cast<mfem::Vector &>(snap_gf->Real()) = gf->Real();
+    snap_gf->Real().FaceNbrData() = gf->Real().FaceNbrData();
+    if (gf->HasImag())
+    {
+      static_cast<mfem::Vector &>(snap_gf->Imag()) = gf->Imag();
+      snap_gf->Imag().FaceNbrData() = gf->Imag().FaceNbrData();
+    }
+  }
+}
+
+template <ProblemType solver_t>
+void PostOperator<solver_t>::WaitForParaviewFields()
+{
+  if (paraview_io.valid())
+  {
+    BlockTimer bt(Timer::POSTPRO_PARAVIEW);
+    paraview_io.get();
+    Mpi::Barrier(fem_op->GetComm());
   }
 }
 
@@ -1443,12 +2467,17 @@ PostOperator<ProblemType::MAGNETOSTATIC>::MeasureAndPrintAll<ProblemType::MAGNET
 
 template auto
 PostOperator<ProblemType::TRANSIENT>::MeasureAndPrintAll<ProblemType::TRANSIENT>(
-    int step, const Vector &e, const Vector &b, double t, double J_coef) -> double;
+    int ex_idx, int step, const Vector &e, const Vector &b, double t, double J_coef,
+    bool measure_all) -> double;
 
 template auto
 PostOperator<ProblemType::DRIVEN>::MeasureDomainFieldEnergyOnly<ProblemType::DRIVEN>(
     const ComplexVector &e, const ComplexVector &b) -> double;
 
+template auto
+PostOperator<ProblemType::TRANSIENT>::MeasureDomainFieldEnergyOnly<ProblemType::TRANSIENT>(
+    const Vector &e, const Vector &b) -> double;
+
 template auto
 PostOperator<ProblemType::DRIVEN>::InitializeParaviewDataCollection<ProblemType::DRIVEN>(
     int ex_idx) -> void;
@@ -4,13 +4,15 @@
 #ifndef PALACE_MODELS_POST_OPERATOR_HPP
 #define PALACE_MODELS_POST_OPERATOR_HPP
 
+#include <algorithm>
 #include <complex>
+#include <future>
 #include <map>
 #include <memory>
-#include <optional>
 #include <type_traits>
 #include <vector>
 #include <mfem.hpp>
+#include "fem/fespace.hpp"
 #include "fem/gridfunction.hpp"
 #include "fem/interpolator.hpp"
 #include "linalg/operator.hpp"
@@ -113,6 +115,13 @@ protected:
   // Field output format control flags.
   bool enable_paraview_output = false;
   bool enable_gridfunction_output = false;
+  bool enable_xdmf_output = false;
+
+  // Floating point precision (bits), compression level, and selection of fields for output
+  // (all fields when empty).
+  int output_precision = 32;
+  int output_compression = 0;
+  std::vector<std::string> output_fields = {};
 
   // How many / which fields to output.
   int output_delta_post = 0;                          // printing rate (TRANSIENT)
@@ -122,13 +131,21 @@ protected:
   // Whether any output formats were specified.
   bool AnyOutputFormats() const
   {
-    return enable_paraview_output || enable_gridfunction_output;
+    return enable_paraview_output || enable_gridfunction_output || enable_xdmf_output;
   }
   bool AnythingToSave() const
   {
     return (output_delta_post > 0) || (output_n_post > 0) || !output_save_indices.empty();
   }
 
+  // Whether the field with the given name is selected for output.
+  bool IsOutputField(const std::string &name) const
+  {
+    return output_fields.empty() ||
+           std::find(output_fields.begin(), output_fields.end(), name) !=
+               output_fields.end();
+  }
+
   // Whether any fields should be written at all.
   bool ShouldWriteFields() const { return AnyOutputFormats() && AnythingToSave(); }
 
@@ -159,25 +176,148 @@ protected:
   {
     return enable_gridfunction_output && ShouldWriteFields(step);
   }
+  bool ShouldWriteXdmfFields(std::size_t step) const
+  {
+    return enable_xdmf_output && ShouldWriteFields(step);
+  }
 
   // ParaView data collection: writing fields to disk for visualization.
-  // This is an optional, since ParaViewDataCollection has no default (empty) ctor,
-  // and we only want initialize it if ShouldWriteParaviewFields() returns true.
-  std::optional<mfem::ParaViewDataCollection> paraview, paraview_bdr;
+  // These are pointers, since ParaViewDataCollection has no default (empty) ctor, and we
+  // only want initialize it if ShouldWriteParaviewFields() returns true.
+  std::unique_ptr<mfem::ParaViewDataCollection> paraview, paraview_bdr;
+
+  // ParaView output for each excitation of a transient simulation with several
+  // excitations, which is swapped into paraview and paraview_bdr while writing the fields
+  // of that excitation.
+  struct ParaviewData
+  {
+    std::unique_ptr<mfem::ParaViewDataCollection> paraview, paraview_bdr;
+  };
+  std::map<int, ParaviewData> paraview_ex;
 
   // MFEM grid function output details.
   std::string gridfunction_output_dir;
   const std::size_t pad_digits_default = 6;
 
+  // XDMF output details. The mesh and the fields at each output step are sampled at the
+  // element vertices and written collectively by all processes into a single binary file
+  // each, described by an XDMF file listing the steps written so far.
+  struct XdmfFieldData
+  {
+    std::string name;
+    int num_comp;
+    long long seek;
+  };
+  struct XdmfData
+  {
+    std::string output_dir;
+    int precision = 32;
+    long long num_elem = 0, num_pts = 0, topo_size = 0, coords_seek = 0;
+    std::vector<XdmfFieldData> fields;
+    std::vector<std::pair<int, double>> steps;
+  } xdmf;
+
+  // XDMF output for each excitation of a transient simulation with several excitations,
+  // which is swapped into xdmf while writing the fields of that excitation.
+  std::map<int, XdmfData> xdmf_ex;
+
   // Measurements of field solution for ParaView files (full domain or surfaces).
+  struct FieldCoefficients
+  {
+    // Poynting Coefficient, Electric Boundary Field (re+im), Magnetic Boundary Field
+    // (re+im), Vector Potential Boundary Field, Surface Current (re+im).
+    std::unique_ptr<mfem::VectorCoefficient> S, E_sr, E_si, B_sr, B_si, A_s, J_sr, J_si;
+
+    // Electric Energy Density, Magnetic Energy Density, Scalar Potential Boundary Field,
+    // Surface Charge (re+im).
+    std::unique_ptr<mfem::Coefficient> U_e, U_m, V_s, Q_sr, Q_si;
+  } coeffs;
+
+  // Owned snapshot of the fields for asynchronous ParaView output. At each output step, the
+  // fields are copied into the snapshot grid functions, which are defined on a copy of the
+  // mesh using a duplicated communicator. The ParaView data collections are bound to the
+  // snapshot and saved on a background thread while the computation continues. The
+  // coefficient-derived domain fields are projected onto discontinuous spaces before each
+  // write, so that the background thread only writes grid function data.
+  struct ParaviewSnapshot
+  {
+    MPI_Comm comm = MPI_COMM_NULL;
+    std::unique_ptr<Mesh> mesh;
+    std::vector<std::unique_ptr<FiniteElementSpace>> fespaces;
+    std::unique_ptr<GridFunction> E, B, V, A;
+    FieldCoefficients coeffs;
+
+    struct ProjectedField
+    {
+      mfem::Coefficient *Q = nullptr;
+      mfem::VectorCoefficient *VQ = nullptr;
+      std::unique_ptr<mfem::ParGridFunction> gf;
+    };
+    std::unique_ptr<mfem::L2_FECollection> l2_fec;
+    std::unique_ptr<mfem::ParFiniteElementSpace> l2_fespace, l2_vfespace;
+    std::vector<ProjectedField> projected;
+
+    // Return the grid function holding the projection of the given coefficient, creating
+    // it on first use.
+    template <typename CoeffType>
+    mfem::ParGridFunction *GetProjectedField(CoeffType *Q)
+    {
+      for (auto &field : projected)
+      {
+        if (field.Q == static_cast<void *>(Q) || field.VQ == static_cast<void *>(Q))
+        {
+          return field.gf.get();
+        }
+      }
+      auto &field = projected.emplace_back();
+      if constexpr (std::is_base_of_v<mfem::VectorCoefficient, CoeffType>)
+      {
+        field.VQ = Q;
+        field.gf = std::make_unique<mfem::ParGridFunction>(l2_vfespace.get());
+      }
+      else
+      {
+        field.Q = Q;
+        field.gf = std::make_unique<mfem::ParGridFunction>(l2_fespace.get());
+      }
+      return field.gf.get();
+    }
 
-  // Poynting Coefficient, Electric Boundary Field (re+im), Magnetic Boundary Field (re+im),
-  // Vector Potential Boundary Field, Surface Current (re+im).
-  std::unique_ptr<mfem::VectorCoefficient> S, E_sr, E_si, B_sr, B_si, A_s, J_sr, J_si;
+    void ProjectFields()
+    {
+      for (auto &field : projected)
+      {
+        if (field.Q)
+        {
+          field.gf->ProjectCoefficient(*field.Q);
+        }
+        else
+        {
+          field.gf->ProjectCoefficient(*field.VQ);
+        }
+      }
+    }
 
-  // Electric Energy Density, Magnetic Energy Density, Scalar Potential Boundary Field,
-  // Surface Charge (re+im).
-  std::unique_ptr<mfem::Coefficient> U_e, U_m, V_s, Q_sr, Q_si;
+    ~ParaviewSnapshot()
+    {
+      // Release the objects using the duplicated communicator before freeing it.
+      projected.clear();
+      l2_vfespace.reset();
+      l2_fespace.reset();
+      coeffs = {};
+      E.reset();
+      B.reset();
+      V.reset();
+      A.reset();
+      fespaces.clear();
+      mesh.reset();
+      if (comm != MPI_COMM_NULL)
+      {
+        MPI_Comm_free(&comm);
+      }
+    }
+  };
+  std::unique_ptr<ParaviewSnapshot> paraview_snapshot;
 
   // Wave port boundary mode field postprocessing.
   struct WavePortFieldData
@@ -186,12 +326,24 @@ protected:
   };
   std::map<int, WavePortFieldData> port_E0;
 
-  // Setup coefficients for field postprocessing.
-  void SetupFieldCoefficients();
+  // Setup coefficients for field postprocessing of the given grid functions.
+  void SetupFieldCoefficients(GridFunction *E, GridFunction *B, GridFunction *V,
+                              GridFunction *A, FieldCoefficients &c) const;
+
+  // Helpers for asynchronous field output. UpdateParaviewSnapshot copies the current fields
+  // into the snapshot, and WaitForParaviewFields blocks until any pending ParaView output
+  // has been written.
+  void InitializeParaviewSnapshot(const IoData &iodata);
+  void UpdateParaviewSnapshot();
+  void WaitForParaviewFields();
 
   // Initialize Paraview, register all fields to write.
   void InitializeParaviewDataCollection(const fs::path &sub_folder_name = "");
 
+  // Output subfolder for the given excitation, which is empty unless the problem has
+  // several excitations.
+  fs::path ExcitationFolderName(int ex_idx) const;
+
 public:
 
 
@@ -203,6 +355,7 @@ protected:
   void WriteParaviewFieldsFinal(const ErrorIndicator *indicator = nullptr);
   void WriteMFEMGridFunctions(double time, int step);
   void WriteMFEMGridFunctionsFinal(const ErrorIndicator *indicator = nullptr);
+  void WriteXdmfFields(double time, int step);
 
   // CSV Measure & Print.
 
@@ -238,6 +391,33 @@ protected:
   void MeasureInterfaceEFieldEnergy() const;  // Depends: LumpedPorts
   void MeasureProbes() const;
 
+  // Mark the measurements skipped by a reduced transient measurement as not-a-number, with
+  // the same layout as a full measurement.
+  void MeasureSkipped() const;
+
+  // Running discrete Fourier transforms of the transient excitation, lumped port voltages,
+  // currents, and mode projections, and optionally the fields, at the requested
+  // frequencies. At the end of the simulation these are normalized by the transform of the
+  // excitation to obtain the frequency domain response to a unit incident wave. The
+  // transforms are accumulated separately for each excitation.
+  struct TransientDFTData
+  {
+    std::vector<std::complex<double>> J;
+    std::map<int, std::vector<std::complex<double>>> V, I, S;
+    std::vector<ComplexVector> E, B;
+  };
+  std::vector<double> dft_omega;
+  std::map<int, TransientDFTData> dft;
+
+  // Accumulate the contribution of the current time step to the transforms (measurements
+  // must already have been computed). This costs O(# frequencies) per port, and
+  // O(# frequencies × # dofs) when the fields are transformed.
+  void UpdateDFT(double time, const Vector &e, const Vector &b);
+
+  // Write the transformed port quantities and S-parameters to csv files, and the
+  // transformed fields for visualization.
+  void WriteDFT();
+
   // Helper function called by all solvers. Has to ensure correct call order to deal with
   // dependent measurements.
   void MeasureAllImpl() const
@@ -380,9 +560,15 @@ public:
   auto MeasureAndPrintAll(int step, const Vector &a, const Vector &b, int idx)
       -> std::enable_if_t<U == ProblemType::MAGNETOSTATIC, double>;
 
+  // For the transient solver, measure_all = false performs only the inexpensive boundary
+  // measurements (ports) and records the volume, surface flux, interface, and probe
+  // measurements as not-a-number, so that these can be computed at a reduced cadence. When
+  // several excitations are integrated together, this is called for each excitation at
+  // every step, and the excitation index selects the csv columns, the field output
+  // subfolder, and the transforms to update.
   template <ProblemType U = solver_t>
-  auto MeasureAndPrintAll(int step, const Vector &e, const Vector &b, double t,
-                          double J_coef)
+  auto MeasureAndPrintAll(int ex_idx, int step, const Vector &e, const Vector &b, double t,
+                          double J_coef, bool measure_all = true)
       -> std::enable_if_t<U == ProblemType::TRANSIENT, double>;
 
   // Write error indicator into ParaView file and print summary statistics to csv. Should be
@@ -398,6 +584,12 @@ public:
   auto MeasureDomainFieldEnergyOnly(const ComplexVector &e, const ComplexVector &b)
       -> std::enable_if_t<U == ProblemType::DRIVEN, double>;
 
+  // Similarly, for the transient solver when error estimation is performed on a time step
+  // without a full measurement.
+  template <ProblemType U = solver_t>
+  auto MeasureDomainFieldEnergyOnly(const Vector &e, const Vector &b)
+      -> std::enable_if_t<U == ProblemType::TRANSIENT, double>;
+
   // Public overload for the driven solver only, that takes in an excitation index and
   // sets the correct sub_folder_name path for the primary function above.
   template <ProblemType U = solver_t>
@@ -447,6 +639,11 @@ public:
   // Expose MPI communicator from fem_op for electrostatic & magnetostatic matrix processing
   // (see above).
   auto GetComm() const { return fem_op->GetComm(); }
+
+private:
+  // Pending asynchronous ParaView output. Declared last so that it is destroyed (and
+  // waited on) before any of the objects accessed by the background thread.
+  std::future<void> paraview_io;
 };
 
 
@@ -25,14 +25,15 @@ using namespace std::complex_literals;
 SpaceOperator::SpaceOperator(const IoData &iodata,
                              const std::vector<std::unique_ptr<Mesh>> &mesh)
   : pc_mat_real(iodata.solver.linear.pc_mat_real),
-    pc_mat_shifted(iodata.solver.linear.pc_mat_shifted), print_hdr(true),
+    pc_mat_shifted(iodata.solver.linear.pc_mat_shifted),
+    pc_mat_lor(iodata.solver.linear.pc_mat_lor), print_hdr(true),
     print_prec_hdr(true), dbc_attr(SetUpBoundaryProperties(iodata, *mesh.back())),
     nd_fecs(fem::ConstructFECollections<mfem::ND_FECollection>(
         iodata.solver.order, mesh.back()->Dimension(), iodata.solver.linear.mg_max_levels,
-        iodata.solver.linear.mg_coarsening, false)),
+        iodata.solver.linear.mg_coarsening, pc_mat_lor)),
     h1_fecs(fem::ConstructFECollections<mfem::H1_FECollection>(
         iodata.solver.order, mesh.back()->Dimension(), iodata.solver.linear.mg_max_levels,
-        iodata.solver.linear.mg_coarsening, false)),
+        iodata.solver.linear.mg_coarsening, pc_mat_lor)),
     rt_fecs(fem::ConstructFECollections<mfem::RT_FECollection>(
         iodata.solver.order - 1, mesh.back()->Dimension(),
         iodata.solver.linear.estimator_mg ? iodata.solver.linear.mg_max_levels : 1,
@@ -64,9 +65,8 @@ SpaceOperator::SpaceOperator(const IoData &iodata,
   }
   else if (iodata.problem.type == ProblemType::TRANSIENT)
   {
-    MFEM_VERIFY(
-        port_excitation_helper.Size() == 1,
-        "Transient problems currently only support a single excitation per simulation!");
+    MFEM_VERIFY(!port_excitation_helper.Empty(),
+                "Transient problems must specify at least one excitation!");
   }
   else
   {
@@ -308,11 +308,11 @@ auto AssembleOperators(const FiniteElementSpaceHierarchy &fespaces,
                        const MaterialPropertyCoefficient *dfb,
                        const MaterialPropertyCoefficient *fb,
                        const MaterialPropertyCoefficient *fp, bool skip_zeros = false,
-                       bool assemble_q_data = false, std::size_t l0 = 0)
+                       bool assemble_q_data = false, std::size_t l0 = 0, bool lor = false)
 {
   BilinearForm a(fespaces.GetFinestFESpace());
   AddIntegrators(a, df, f, dfb, fb, fp, assemble_q_data);
-  return a.Assemble(fespaces, skip_zeros, l0);
+  return a.Assemble(fespaces, skip_zeros, l0, lor);
 }
 
 auto AssembleAuxOperators(const FiniteElementSpaceHierarchy &fespaces,
@@ -573,14 +573,14 @@ void SpaceOperator::AssemblePreconditioner(
   if (!empty[0])
   {
     br_vec = AssembleOperators(GetNDSpaces(), &dfr, &fr, &dfbr, &fbr, &fpr, skip_zeros,
-                               assemble_q_data);
+                               assemble_q_data, 0, pc_mat_lor);
     br_aux_vec =
         AssembleAuxOperators(GetH1Spaces(), &fr, &fbr, skip_zeros, assemble_q_data);
   }
   if (!empty[1])
   {
     bi_vec = AssembleOperators(GetNDSpaces(), &dfi, &fi, &dfbi, &fbi, &fpi, skip_zeros,
-                               assemble_q_data);
+                               assemble_q_data, 0, pc_mat_lor);
     bi_aux_vec =
         AssembleAuxOperators(GetH1Spaces(), &fi, &fbi, skip_zeros, assemble_q_data);
   }
@@ -607,7 +607,7 @@ void SpaceOperator::AssemblePreconditioner(
   if (!empty)
   {
     br_vec = AssembleOperators(GetNDSpaces(), &dfr, &fr, &dfbr, &fbr, nullptr, skip_zeros,
-                               assemble_q_data);
+                               assemble_q_data, 0, pc_mat_lor);
     br_aux_vec =
         AssembleAuxOperators(GetH1Spaces(), &fr, &fbr, skip_zeros, assemble_q_data);
   }
@@ -634,7 +634,7 @@ void SpaceOperator::AssemblePreconditioner(
   if (!empty)
   {
     br_vec = AssembleOperators(GetNDSpaces(), &dfr, &fr, &dfbr, &fbr, nullptr, skip_zeros,
-                               assemble_q_data);
+                               assemble_q_data, 0, pc_mat_lor);
     br_aux_vec =
         AssembleAuxOperators(GetH1Spaces(), &fr, &fbr, skip_zeros, assemble_q_data);
   }
@@ -648,7 +648,8 @@ std::unique_ptr<OperType> SpaceOperator::GetPreconditionerMatrix(ScalarType a0,
   // When partially assembled, the coarse operators can reuse the fine operator quadrature
   // data if the spaces correspond to the same mesh. When appropriate, we build the
   // preconditioner on all levels based on the actual complex-valued system matrix. The
-  // coarse operator is always fully assembled.
+  // coarse operator is always fully assembled, optionally on its low-order-refined (LOR)
+  // discretization.
   if (print_prec_hdr)
   {
     Mpi::Print("\nAssembling multigrid hierarchy:\n");
@@ -3,16 +3,19 @@
 
 #include "surfacepostoperator.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <complex>
 #include <set>
 #include "fem/gridfunction.hpp"
 #include "fem/integrator.hpp"
 #include "linalg/vector.hpp"
 #include "models/materialoperator.hpp"
-#include "models/strattonchu.hpp"
 #include "utils/communication.hpp"
 #include "utils/geodata.hpp"
 #include "utils/iodata.hpp"
+#include "utils/omp.hpp"
 #include "utils/prettyprint.hpp"
 #include "utils/timer.hpp"
 
@@ -56,6 +59,83 @@ mfem::Array<int> SetUpBoundaryProperties(const T &data,
   return attr_list;
 }
 
+// Equivalent surface currents n x E and n x H (n the outward normal) at the quadrature
+// points of the far-field boundary, premultiplied by the quadrature weights, along with
+// the quadrature point coordinates. Stored as a structure of arrays for vectorization.
+struct FarFieldSources
+{
+  std::array<std::vector<double>, 3> x, Er, Ei, Hr, Hi;
+  std::size_t Size() const { return x[0].size(); }
+};
+
+FarFieldSources GetFarFieldSources(const GridFunction &E, const GridFunction &B,
+                                   const MaterialOperator &mat_op,
+                                   const mfem::ParFiniteElementSpace &nd_fespace,
+                                   const mfem::Array<int> &attr_marker)
+{
+  auto &mesh = const_cast<mfem::ParMesh &>(*nd_fespace.GetParMesh());
+  FarFieldSources src;
+  mfem::FaceElementTransformations FET;
+  mfem::IsoparametricTransformation T1, T2;
+  double normal_data[3], x_data[3], U_data[3], W_data[3];
+  mfem::Vector normal(normal_data, 3), x(x_data, 3), U(U_data, 3), W(W_data, 3);
+  auto push_cross = [&normal](const mfem::Vector &V, double w,
+                              std::array<std::vector<double>, 3> &out)
+  {
+    out[0].push_back(w * (normal(1) * V(2) - normal(2) * V(1)));
+    out[1].push_back(w * (normal(2) * V(0) - normal(0) * V(2)));
+    out[2].push_back(w * (normal(0) * V(1) - normal(1) * V(0)));
+  };
+  for (int i = 0; i < mesh.GetNBE(); i++)
+  {
+    if (!attr_marker[mesh.GetBdrAttribute(i) - 1])
+    {
+      continue;
+    }
+    auto &T = *mesh.GetBdrElementTransformation(i);
+    const auto &ir = mfem::IntRules.Get(mesh.GetBdrElementGeometry(i),
+                                        fem::DefaultIntegrationOrder::Get(T));
+    for (int j = 0; j < ir.GetNPoints(); j++)
+    {
+      // Tangential E and H are continuous across internal boundaries, so the neighboring
+      // element 1 is used to evaluate the fields.
+      const auto &ip = ir.IntPoint(j);
+      T.SetIntPoint(&ip);
+      bool ori = BdrGridFunctionCoefficient::GetBdrElementNeighborTransformations(
+          i, mesh, FET, T1, T2, &ip);
+      BdrGridFunctionCoefficient::GetNormal(T, normal, !ori);
+      const double w = ip.weight * T.Weight();
+      T.Transform(ip, x);
+      for (int d = 0; d < 3; d++)
+      {
+        src.x[d].push_back(x(d));
+      }
+      const auto &ip1 = FET.Elem1->GetIntPoint();
+      const auto &muinv = mat_op.GetInvPermeability(FET.Elem1->Attribute);
+      E.Real().GetVectorValue(*FET.Elem1, ip1, U);
+      push_cross(U, w, src.Er);
+      B.Real().GetVectorValue(*FET.Elem1, ip1, W);
+      muinv.Mult(W, U);
+      push_cross(U, w, src.Hr);
+      if (E.HasImag())
+      {
+        E.Imag().GetVectorValue(*FET.Elem1, ip1, U);
+        push_cross(U, w, src.Ei);
+        B.Imag().GetVectorValue(*FET.Elem1, ip1, W);
+        muinv.Mult(W, U);
+        push_cross(U, w, src.Hi);
+      }
+      else
+      {
+        U = 0.0;
+        push_cross(U, w, src.Ei);
+        push_cross(U, w, src.Hi);
+      }
+    }
+  }
+  return src;
+}
+
 }  // namespace
 
 SurfacePostOperator::SurfaceFluxData::SurfaceFluxData(
@@ -377,6 +457,13 @@ std::vector<std::array<std::complex<double>, 3>> SurfacePostOperator::GetFarFiel
   int bdr_attr_max = mesh.bdr_attributes.Size() ? mesh.bdr_attributes.Max() : 0;
   mfem::Array<int> attr_marker = mesh::AttrToMarker(bdr_attr_max, farfield.attr_list);
 
+  // Evaluate the equivalent surface currents once, then integrate for all directions
+  // r̂: ∫ (n x E - r̂ x (n x H)) exp(i k r̂ ⋅ r') dS', with complex k = ω in nondimensional
+  // units. The cost is dominated by this O(N_q N_dir) kernel, which is threaded over
+  // blocks of directions and vectorized over the quadrature points. The quadrature points
+  // are processed in tiles which are reused in cache for all directions of a block.
+  const FarFieldSources src = GetFarFieldSources(E, B, mat_op, nd_fespace, attr_marker);
+
   // Integrate. Each MPI process computes its contribution and we will reduce
   // everything at the end. We make them std::vector<std::array<double, 3>>
   // because we want a very simple memory layout so that we can reduce
@@ -384,18 +471,55 @@ std::vector<std::array<std::complex<double>, 3>> SurfacePostOperator::GetFarFiel
   std::vector<std::array<double, 3>> integrals_r(theta_phi_pairs.size());
   std::vector<std::array<double, 3>> integrals_i(theta_phi_pairs.size());
 
-  for (int i = 0; i < mesh.GetNBE(); i++)
+  const auto num_pts = static_cast<std::ptrdiff_t>(src.Size());
+  const auto num_dirs = static_cast<std::ptrdiff_t>(r_naughts.size());
+  constexpr std::ptrdiff_t dir_block_size = 16, pt_tile_size = 512;
+  const double *x0 = src.x[0].data(), *x1 = src.x[1].data(), *x2 = src.x[2].data();
+  const double *Er0 = src.Er[0].data(), *Er1 = src.Er[1].data(), *Er2 = src.Er[2].data();
+  const double *Ei0 = src.Ei[0].data(), *Ei1 = src.Ei[1].data(), *Ei2 = src.Ei[2].data();
+  const double *Hr0 = src.Hr[0].data(), *Hr1 = src.Hr[1].data(), *Hr2 = src.Hr[2].data();
+  const double *Hi0 = src.Hi[0].data(), *Hi1 = src.Hi[1].data(), *Hi2 = src.Hi[2].data();
+  PalacePragmaOmp(parallel for schedule(dynamic))
+  for (std::ptrdiff_t kb = 0; kb < num_dirs; kb += dir_block_size)
   {
-    if (!attr_marker[mesh.GetBdrAttribute(i) - 1])
-      continue;
-
-    auto *T = const_cast<mfem::ParMesh &>(mesh).GetBdrElementTransformation(i);
-    const auto *fe = nd_fespace.GetBE(i);
-    const auto *ir =
-        &mfem::IntRules.Get(fe->GetGeomType(), fem::DefaultIntegrationOrder::Get(*T));
-
-    AddStrattonChuIntegrandAtElement(E, B, mat_op, omega_re, omega_im, r_naughts, *T, *ir,
-                                     integrals_r, integrals_i);
+    const std::ptrdiff_t ke = std::min(kb + dir_block_size, num_dirs);
+    for (std::ptrdiff_t qb = 0; qb < num_pts; qb += pt_tile_size)
+    {
+      const std::ptrdiff_t qe = std::min(qb + pt_tile_size, num_pts);
+      for (std::ptrdiff_t k = kb; k < ke; k++)
+      {
+        const double r0 = r_naughts[k][0], r1 = r_naughts[k][1], r2 = r_naughts[k][2];
+        double sr0 = 0.0, sr1 = 0.0, sr2 = 0.0, si0 = 0.0, si1 = 0.0, si2 = 0.0;
+        PalacePragmaOmp(simd reduction(+ : sr0, sr1, sr2, si0, si1, si2))
+        for (std::ptrdiff_t q = qb; q < qe; q++)
+        {
+          // Phase factor exp(i k r̂ ⋅ r').
+          const double d = r0 * x0[q] + r1 * x1[q] + r2 * x2[q];
+          const double a = std::exp(-omega_im * d);
+          const double pr = a * std::cos(omega_re * d), pi = a * std::sin(omega_re * d);
+
+          // v = n x E - r̂ x (n x H).
+          const double vr0 = Er0[q] - (r1 * Hr2[q] - r2 * Hr1[q]);
+          const double vr1 = Er1[q] - (r2 * Hr0[q] - r0 * Hr2[q]);
+          const double vr2 = Er2[q] - (r0 * Hr1[q] - r1 * Hr0[q]);
+          const double vi0 = Ei0[q] - (r1 * Hi2[q] - r2 * Hi1[q]);
+          const double vi1 = Ei1[q] - (r2 * Hi0[q] - r0 * Hi2[q]);
+          const double vi2 = Ei2[q] - (r0 * Hi1[q] - r1 * Hi0[q]);
+          sr0 += pr * vr0 - pi * vi0;
+          sr1 += pr * vr1 - pi * vi1;
+          sr2 += pr * vr2 - pi * vi2;
+          si0 += pr * vi0 + pi * vr0;
+          si1 += pr * vi1 + pi * vr1;
+          si2 += pr * vi2 + pi * vr2;
+        }
+        integrals_r[k][0] += sr0;
+        integrals_r[k][1] += sr1;
+        integrals_r[k][2] += sr2;
+        integrals_i[k][0] += si0;
+        integrals_i[k][1] += si1;
+        integrals_i[k][2] += si2;
+      }
+    }
   }
 
   double *data_r_ptr = integrals_r.data()->data();
@@ -404,12 +528,21 @@ std::vector<std::array<std::complex<double>, 3>> SurfacePostOperator::GetFarFiel
   Mpi::GlobalSum(total_elements, data_i_ptr, E.GetComm());
   Mpi::GlobalSum(total_elements, data_r_ptr, E.GetComm());
 
-  // Finally, we apply cross product to reduced integrals and package the result
-  // in a neatly accessible vector of arrays of complex numbers.
+  // Finally, we apply the prefactor i k / 4π and the cross product to the reduced
+  // integrals and package the result in a neatly accessible vector of arrays of complex
+  // numbers.
+  const std::complex<double> prefactor =
+      std::complex<double>(-omega_im, omega_re) / (4.0 * M_PI);
   std::vector<std::array<std::complex<double>, 3>> result(theta_phi_pairs.size());
   StaticVector<3> tmp_r, tmp_i;
   for (size_t k = 0; k < theta_phi_pairs.size(); k++)
   {
+    for (size_t d = 0; d < 3; d++)
+    {
+      const auto v = prefactor * std::complex<double>(integrals_r[k][d], integrals_i[k][d]);
+      integrals_r[k][d] = v.real();
+      integrals_i[k][d] = v.imag();
+    }
     linalg::Cross3(r_naughts[k], integrals_r[k], tmp_r);
     linalg::Cross3(r_naughts[k], integrals_i[k], tmp_i);
     for (size_t d = 0; d < 3; d++)
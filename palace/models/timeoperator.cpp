@@ -3,10 +3,13 @@
 
 #include "timeoperator.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <vector>
 #include "linalg/iterative.hpp"
 #include "linalg/jacobi.hpp"
+#include "linalg/rap.hpp"
 #include "linalg/solver.hpp"
 #include "models/portexcitations.hpp"
 #include "models/spaceoperator.hpp"
@@ -19,43 +22,118 @@ namespace palace
 namespace
 {
 
+// Helper for referencing the blocks of a state vector which stores one [Edot, E, B] column
+// for each excitation, so that operators can be applied to the columns using
+// multiple-vector operator applications. These process the columns in pairs (see
+// ParOperator::ArrayMult), so the cost of applying the local operator is shared by two
+// excitations, not by all of them.
+class StateBlocks
+{
+public:
+  std::vector<Vector> x1, x2, x3;
+
+  StateBlocks(Vector &u, int n, int size_E, int size_B) : x1(n), x2(n), x3(n)
+  {
+    MakeRefs(u, n, size_E, size_B);
+  }
+
+  // The blocks of a const state vector are only read from.
+  StateBlocks(const Vector &u, int n, int size_E, int size_B) : x1(n), x2(n), x3(n)
+  {
+    u.Read();
+    MakeRefs(const_cast<Vector &>(u), n, size_E, size_B);
+  }
+
+private:
+  void MakeRefs(Vector &v, int n, int size_E, int size_B)
+  {
+    const int size = 2 * size_E + size_B;
+    for (int c = 0; c < n; c++)
+    {
+      x1[c].UseDevice(true);
+      x2[c].UseDevice(true);
+      x3[c].UseDevice(true);
+      x1[c].MakeRef(v, c * size, size_E);
+      x2[c].MakeRef(v, c * size + size_E, size_E);
+      x3[c].MakeRef(v, c * size + 2 * size_E, size_B);
+    }
+  }
+};
+
+inline mfem::Array<const Vector *> ConstPtrs(const std::vector<Vector> &x)
+{
+  mfem::Array<const Vector *> X(static_cast<int>(x.size()));
+  for (std::size_t c = 0; c < x.size(); c++)
+  {
+    X[c] = &x[c];
+  }
+  return X;
+}
+
+inline mfem::Array<Vector *> Ptrs(std::vector<Vector> &x)
+{
+  mfem::Array<Vector *> X(static_cast<int>(x.size()));
+  for (std::size_t c = 0; c < x.size(); c++)
+  {
+    X[c] = &x[c];
+  }
+  return X;
+}
+
 class TimeDependentFirstOrderOperator : public mfem::TimeDependentOperator
 {
 public:
   // MPI communicator.
   MPI_Comm comm;
 
-  // System matrices and excitation RHS.
+  // System matrices and excitation RHS (one for each excitation, which are all integrated
+  // together as independent columns of the state vector).
   std::unique_ptr<Operator> K, M, C;
-  Vector NegJ;
+  std::vector<Vector> NegJ;
 
   // Time dependence of current pulse for excitation: -J'(t) = -g'(t) J. This function
   // returns g'(t).
   std::function<double(double)> dJ_coef;
 
+  // Inverse of the lumped (diagonal) mass matrix, for the explicit leapfrog scheme.
+  Vector Minv;
+
   // Internal objects for solution of linear systems during time stepping.
   double dt_, saved_gamma;
   std::unique_ptr<KspSolver> kspM, kspA;
   std::unique_ptr<Operator> A, B;
   mutable Vector RHS;
-  int size_E, size_B;
+  int size_E, size_B, n_ex;
+
+  // Preconditioner reuse across time step changes: time step for which the preconditioner
+  // was constructed, iterations of the first and most recent solves with it, and the
+  // thresholds for reconstruction.
+  double dt_pc;
+  int pc_it_ref, pc_it_last, num_pc_update;
+  double pc_update_ratio, pc_update_it;
 
   const Operator &Curl;
 
   // Bindings to SpaceOperator functions to get the system matrix and preconditioner, and
-  // construct the linear solver.
-  std::function<void(double dt)> ConfigureLinearSolver;
+  // construct the linear solver. The preconditioner is only reconstructed if requested,
+  // otherwise just the (matrix-free) system matrix is updated for the new time step.
+  std::function<void(double dt, bool update_pc)> ConfigureLinearSolver;
 
 public:
   TimeDependentFirstOrderOperator(const IoData &iodata, SpaceOperator &space_op,
                                   std::function<double(double)> dJ_coef, double t0,
                                   mfem::TimeDependentOperator::Type type)
-    : mfem::TimeDependentOperator(2 * space_op.GetNDSpace().GetTrueVSize() +
-                                      space_op.GetRTSpace().GetTrueVSize(),
+    : mfem::TimeDependentOperator(space_op.GetPortExcitations().Size() *
+                                      (2 * space_op.GetNDSpace().GetTrueVSize() +
+                                       space_op.GetRTSpace().GetTrueVSize()),
                                   t0, type),
       comm(space_op.GetComm()), dJ_coef(dJ_coef),
       size_E(space_op.GetNDSpace().GetTrueVSize()),
-      size_B(space_op.GetRTSpace().GetTrueVSize()), Curl(space_op.GetCurlMatrix())
+      size_B(space_op.GetRTSpace().GetTrueVSize()),
+      n_ex(space_op.GetPortExcitations().Size()), dt_pc(0.0), pc_it_ref(0), pc_it_last(0),
+      num_pc_update(0),
+      pc_update_ratio(iodata.solver.transient.pc_update_ratio),
+      pc_update_it(iodata.solver.transient.pc_update_it), Curl(space_op.GetCurlMatrix())
   {
     // Construct the system matrices defining the linear operator. PEC boundaries are
     // handled simply by setting diagonal entries of the mass matrix for the corresponding
@@ -65,16 +143,25 @@ public:
     C = space_op.GetDampingMatrix<Operator>(Operator::DIAG_ZERO);
     M = space_op.GetMassMatrix<Operator>(Operator::DIAG_ONE);
 
-    // Already asserted that only that time dependent solver only has a single excitation.
-    auto excitation_helper = space_op.GetPortExcitations();
-    auto excitation_idx = excitation_helper.excitations.begin()->first;
-    // Set up RHS vector for the current source term: -g'(t) J, where g(t) handles the time
-    // dependence.
-    space_op.GetExcitationVector(excitation_idx, NegJ);
-    RHS.SetSize(2 * size_E + size_B);
+    // Set up RHS vectors for the current source terms: -g'(t) J, where g(t) handles the
+    // time dependence (shared by all excitations).
+    NegJ.resize(n_ex);
+    int c = 0;
+    for (const auto &[excitation_idx, excitation_spec] : space_op.GetPortExcitations())
+    {
+      space_op.GetExcitationVector(excitation_idx, NegJ[c++]);
+    }
+    RHS.SetSize(n_ex * (2 * size_E + size_B));
     RHS.UseDevice(true);
 
-    // Set up linear solvers.
+    // Set up linear solvers. The explicit leapfrog scheme replaces the mass matrix by a
+    // lumped (diagonal) one, so no linear solves are needed.
+    if (iodata.solver.transient.leapfrog)
+    {
+      AssembleLumpedMass(iodata, space_op);
+      CheckLeapfrogTimeStep(iodata);
+      return;
+    }
     {
       auto pcg = std::make_unique<CgSolver<Operator>>(comm, 0);
       pcg->SetInitialGuess(0);
@@ -89,58 +176,154 @@ public:
       // For explicit schemes, recommended to just use cheaper preconditioners. Otherwise,
       // use AMS or a direct solver. The system matrix is formed as a sequence of matrix
       // vector products, and is only assembled for preconditioning.
-      ConfigureLinearSolver = [this, &iodata, &space_op](double dt)
+      ConfigureLinearSolver = [this, &iodata, &space_op](double dt, bool update_pc)
       {
-        // Configure the system matrix and also the matrix (matrices) from which the
-        // preconditioner will be constructed.
+        // Configure the system matrix, which only re-weights the existing matrix-free
+        // operators and requires no assembly.
         A = space_op.GetSystemMatrix(dt * dt, dt, 1.0, K.get(), C.get(), M.get());
-        B = space_op.GetPreconditionerMatrix<Operator>(dt * dt, dt, 1.0, 0.0);
+        if (kspA && !update_pc)
+        {
+          kspA->SetOperator(*A);
+          return;
+        }
 
-        // Configure the solver.
+        // Configure the matrix (matrices) from which the preconditioner will be
+        // constructed, and the solver.
+        B = space_op.GetPreconditionerMatrix<Operator>(dt * dt, dt, 1.0, 0.0);
         if (!kspA)
         {
           kspA = std::make_unique<KspSolver>(iodata, space_op.GetNDSpaces(),
                                              &space_op.GetH1Spaces());
         }
         kspA->SetOperators(*A, *B);
+        dt_pc = dt;
+        pc_it_ref = pc_it_last = 0;
+        num_pc_update++;
       };
     }
   }
 
+  // Update the linear solver for a new time step, reconstructing the preconditioner only if
+  // the time step has changed by more than the allowed ratio since it was built or the
+  // linear solver iterations have grown too much with it.
+  void UpdateLinearSolver(double dt)
+  {
+    bool update_pc = true;
+    if (kspA)
+    {
+      const double ratio = std::max(dt / dt_pc, dt_pc / dt);
+      update_pc = (ratio > pc_update_ratio || pc_it_last > pc_update_it * pc_it_ref);
+    }
+    ConfigureLinearSolver(dt, update_pc);
+  }
+
+  // Solve with the system matrix for all excitations together, recording the iterations
+  // for the preconditioner reuse policy.
+  void SolveA(const std::vector<Vector> &b, std::vector<Vector> &x)
+  {
+    const int it0 = kspA->NumTotalMultIterations();
+    auto X = Ptrs(x);
+    kspA->BlockMult(ConstPtrs(b), X);
+    pc_it_last = kspA->NumTotalMultIterations() - it0;
+    if (pc_it_ref == 0)
+    {
+      pc_it_ref = pc_it_last;
+    }
+  }
+
+  // Construct the inverse of the lumped mass matrix. The assembled mass matrix is released
+  // after lumping, since the explicit scheme has no further use for it. Lumping is only
+  // consistent for lowest-order elements on hexahedra, where it is equivalent to the
+  // trapezoidal rule (and recovers the Yee scheme on Cartesian meshes). Otherwise it
+  // reduces the accuracy of the scheme.
+  void AssembleLumpedMass(const IoData &iodata, const SpaceOperator &space_op)
+  {
+    const auto &mesh = space_op.GetNDSpace().GetParMesh();
+    bool hex = true;
+    for (int e = 0; e < mesh.GetNE(); e++)
+    {
+      hex = hex && (mesh.GetElementGeometry(e) == mfem::Geometry::CUBE);
+    }
+    Mpi::GlobalAnd(1, &hex, comm);
+    if (!hex || iodata.solver.order > 1)
+    {
+      Mpi::Warning(comm, "Mass lumping for the leapfrog scheme is only consistent for "
+                         "first-order elements on hexahedral meshes, expect reduced "
+                         "accuracy!\n");
+    }
+    TimeOperator::GetLumpedMassInverse(*M, Minv);
+    M.reset();
+  }
+
+  // Check the time step against the stability limit of the leapfrog scheme.
+  void CheckLeapfrogTimeStep(const IoData &iodata) const
+  {
+    const double dt_max = TimeOperator::GetLeapfrogTimeStepLimit(comm, *K, Minv);
+    const double dt = iodata.solver.transient.delta_t;
+    Mpi::Print(comm, " Leapfrog time step stability limit: dt ≤ {:.3e} ns\n",
+               iodata.units.Dimensionalize<Units::ValueType::TIME>(dt_max));
+    MFEM_VERIFY(dt <= dt_max,
+                "Time step " << iodata.units.Dimensionalize<Units::ValueType::TIME>(dt)
+                             << " ns exceeds the estimated stability limit "
+                             << iodata.units.Dimensionalize<Units::ValueType::TIME>(dt_max)
+                             << " ns of the explicit leapfrog scheme!");
+  }
+
+  // Advance the solution from t -> t + dt with the explicit leapfrog (central difference)
+  // scheme. The first block of the state vector holds the staggered time derivative
+  // Edot at t - dt / 2 rather than t, and the damping term is evaluated at this staggered
+  // time level:
+  //   Edot(t + dt / 2) = Edot(t - dt / 2) - dt M_L⁻¹ (K E(t) + C Edot(t - dt / 2) + J'(t))
+  //   B(t + dt) = B(t) - dt curl (E(t) + dt / 2 Edot(t + dt / 2))
+  //   E(t + dt) = E(t) + dt Edot(t + dt / 2)
+  // Only operator applications of K, C, and the discrete curl remain per time step.
+  void LeapfrogStep(Vector &u, double t, double dt) const
+  {
+    StateBlocks us(u, n_ex, size_E, size_B), rhs(RHS, n_ex, size_E, size_B);
+    auto U1 = Ptrs(us.x1), U3 = Ptrs(us.x3), RHS1 = Ptrs(rhs.x1);
+
+    K->ArrayMult(ConstPtrs(us.x2), RHS1);
+    if (C)
+    {
+      C->ArrayAddMult(ConstPtrs(us.x1), RHS1, 1.0);
+    }
+    DiagonalOperator Dinv(Minv);
+    for (int c = 0; c < n_ex; c++)
+    {
+      linalg::AXPBYPCZ(-1.0, rhs.x1[c], dJ_coef(t), NegJ[c], 0.0, rhs.x1[c]);
+      Dinv.AddMult(rhs.x1[c], us.x1[c], dt);
+    }
+
+    Curl.ArrayAddMult(ConstPtrs(us.x2), U3, -dt);
+    Curl.ArrayAddMult(ConstPtrs(us.x1), U3, -0.5 * dt * dt);
+    for (int c = 0; c < n_ex; c++)
+    {
+      us.x2[c].Add(dt, us.x1[c]);
+    }
+  }
+
   // Form the RHS for the first-order ODE system.
   void FormRHS(const Vector &u, Vector &rhs) const
   {
-    Vector u1, u2, u3, rhs1, rhs2, rhs3;
-    u1.UseDevice(true);
-    u2.UseDevice(true);
-    u3.UseDevice(true);
-    rhs1.UseDevice(true);
-    rhs2.UseDevice(true);
-    rhs3.UseDevice(true);
-    u.Read();
-    u1.MakeRef(const_cast<Vector &>(u), 0, size_E);
-    u2.MakeRef(const_cast<Vector &>(u), size_E, size_E);
-    u3.MakeRef(const_cast<Vector &>(u), 2 * size_E, size_B);
-    rhs.ReadWrite();
-    rhs1.MakeRef(rhs, 0, size_E);
-    rhs2.MakeRef(rhs, size_E, size_E);
-    rhs3.MakeRef(rhs, 2 * size_E, size_B);
+    StateBlocks us(u, n_ex, size_E, size_B), rhss(rhs, n_ex, size_E, size_B);
+    auto RHS1 = Ptrs(rhss.x1), RHS3 = Ptrs(rhss.x3);
 
     // u1 = Edot, u2 = E, u3 = B
     // rhs1 = -(K * u2 + C * u1) - J(t)
     // rhs2 = u1
     // rhs3 = -curl u2
-    K->Mult(u2, rhs1);
+    K->ArrayMult(ConstPtrs(us.x2), RHS1);
     if (C)
     {
-      C->AddMult(u1, rhs1, 1.0);
+      C->ArrayAddMult(ConstPtrs(us.x1), RHS1, 1.0);
+    }
+    Curl.ArrayMult(ConstPtrs(us.x2), RHS3);
+    for (int c = 0; c < n_ex; c++)
+    {
+      linalg::AXPBYPCZ(-1.0, rhss.x1[c], dJ_coef(t), NegJ[c], 0.0, rhss.x1[c]);
+      rhss.x2[c] = us.x1[c];
+      rhss.x3[c] *= -1;
     }
-    linalg::AXPBYPCZ(-1.0, rhs1, dJ_coef(t), NegJ, 0.0, rhs1);
-
-    rhs2 = u1;
-
-    Curl.Mult(u2, rhs3);
-    rhs3 *= -1;
   }
 
   // Solve M du = rhs
@@ -156,25 +339,14 @@ public:
     }
     FormRHS(u, RHS);
 
-    Vector du1, du2, du3, RHS1, RHS2, RHS3;
-    du1.UseDevice(true);
-    du2.UseDevice(true);
-    du3.UseDevice(true);
-    RHS1.UseDevice(true);
-    RHS2.UseDevice(true);
-    RHS3.UseDevice(true);
-    du.ReadWrite();
-    du1.MakeRef(du, 0, size_E);
-    du2.MakeRef(du, size_E, size_E);
-    du3.MakeRef(du, 2 * size_E, size_B);
-    RHS.ReadWrite();
-    RHS1.MakeRef(RHS, 0, size_E);
-    RHS2.MakeRef(RHS, size_E, size_E);
-    RHS3.MakeRef(RHS, 2 * size_E, size_B);
-
-    kspM->Mult(RHS1, du1);
-    du2 = RHS2;
-    du3 = RHS3;
+    StateBlocks dus(du, n_ex, size_E, size_B), rhs(RHS, n_ex, size_E, size_B);
+    auto DU1 = Ptrs(dus.x1);
+    kspM->BlockMult(ConstPtrs(rhs.x1), DU1);
+    for (int c = 0; c < n_ex; c++)
+    {
+      dus.x2[c] = rhs.x2[c];
+      dus.x3[c] = rhs.x3[c];
+    }
   }
 
   void ImplicitSolve(double dt, const Vector &u, Vector &k) override
@@ -185,39 +357,28 @@ public:
     {
       // Configure the linear solver, including the system matrix and also the matrix
       // (matrices) from which the preconditioner will be constructed.
-      ConfigureLinearSolver(dt);
+      UpdateLinearSolver(dt);
       dt_ = dt;
       k = 0.0;
     }
     Mpi::Print("\n");
     FormRHS(u, RHS);
 
-    Vector k1, k2, k3, RHS1, RHS2, RHS3;
-    k1.UseDevice(true);
-    k2.UseDevice(true);
-    k3.UseDevice(true);
-    RHS1.UseDevice(true);
-    RHS2.UseDevice(true);
-    RHS3.UseDevice(true);
-    k.ReadWrite();
-    k1.MakeRef(k, 0, size_E);
-    k2.MakeRef(k, size_E, size_E);
-    k3.MakeRef(k, 2 * size_E, size_B);
-    RHS.ReadWrite();
-    RHS1.MakeRef(RHS, 0, size_E);
-    RHS2.MakeRef(RHS, size_E, size_E);
-    RHS3.MakeRef(RHS, 2 * size_E, size_B);
+    StateBlocks ks(k, n_ex, size_E, size_B), rhs(RHS, n_ex, size_E, size_B);
+    auto RHS1 = Ptrs(rhs.x1), K3 = Ptrs(ks.x3);
 
     // A k1 = RHS1 - dt K RHS2
-    K->AddMult(RHS2, RHS1, -dt);
-    kspA->Mult(RHS1, k1);
-
-    // k2 = rhs2 + dt k1
-    linalg::AXPBYPCZ(1.0, RHS2, dt, k1, 0.0, k2);
+    K->ArrayAddMult(ConstPtrs(rhs.x2), RHS1, -dt);
+    SolveA(rhs.x1, ks.x1);
+    for (int c = 0; c < n_ex; c++)
+    {
+      // k2 = rhs2 + dt k1
+      linalg::AXPBYPCZ(1.0, rhs.x2[c], dt, ks.x1[c], 0.0, ks.x2[c]);
 
-    // k3 = rhs3 - dt curl k2
-    k3 = RHS3;
-    Curl.AddMult(k2, RHS3, -dt);
+      // k3 = rhs3 - dt curl k2
+      ks.x3[c] = rhs.x3[c];
+    }
+    Curl.ArrayAddMult(ConstPtrs(ks.x2), K3, -dt);
   }
 
   void ExplicitMult(const Vector &u, Vector &v) const override { Mult(u, v); }
@@ -229,7 +390,7 @@ public:
     // Update Jacobian matrix.
     if (!kspA || gamma != saved_gamma)
     {
-      ConfigureLinearSolver(gamma);
+      UpdateLinearSolver(gamma);
     }
 
     // Indicate Jacobian was updated.
@@ -244,41 +405,40 @@ public:
   // Solve (Mass - dt Jacobian) x = Mass b
   int SUNImplicitSolve(const Vector &b, Vector &x, double tol) override
   {
-    Vector b1, b2, b3, x1, x2, x3, RHS1;
-    b1.UseDevice(true);
-    b2.UseDevice(true);
-    b3.UseDevice(true);
-    x1.UseDevice(true);
-    x2.UseDevice(true);
-    x3.UseDevice(true);
-    RHS1.UseDevice(true);
-    b.Read();
-    b1.MakeRef(const_cast<Vector &>(b), 0, size_E);
-    b2.MakeRef(const_cast<Vector &>(b), size_E, size_E);
-    b3.MakeRef(const_cast<Vector &>(b), 2 * size_E, size_B);
-    x.ReadWrite();
-    x1.MakeRef(x, 0, size_E);
-    x2.MakeRef(x, size_E, size_E);
-    x3.MakeRef(x, 2 * size_E, size_B);
-    RHS.ReadWrite();
-    RHS1.MakeRef(RHS, 0, size_E);
+    StateBlocks bs(b, n_ex, size_E, size_B), xs(x, n_ex, size_E, size_B),
+        rhs(RHS, n_ex, size_E, size_B);
+    auto RHS1 = Ptrs(rhs.x1), X3 = Ptrs(xs.x3);
 
     // A x1 = M b1 - dt K b2
-    M->Mult(b1, RHS1);
-    K->AddMult(b2, RHS1, -saved_gamma);
-    kspA->Mult(RHS1, x1);
-
-    // x2 = b2 + dt x1
-    linalg::AXPBYPCZ(1.0, b2, saved_gamma, x1, 0.0, x2);
+    M->ArrayMult(ConstPtrs(bs.x1), RHS1);
+    K->ArrayAddMult(ConstPtrs(bs.x2), RHS1, -saved_gamma);
+    SolveA(rhs.x1, xs.x1);
+    for (int c = 0; c < n_ex; c++)
+    {
+      // x2 = b2 + dt x1
+      linalg::AXPBYPCZ(1.0, bs.x2[c], saved_gamma, xs.x1[c], 0.0, xs.x2[c]);
 
-    // x3 = b3 - dt curl x2
-    x3 = b3;
-    Curl.AddMult(x2, x3, -saved_gamma);
+      // x3 = b3 - dt curl x2
+      xs.x3[c] = bs.x3[c];
+    }
+    Curl.ArrayAddMult(ConstPtrs(xs.x2), X3, -saved_gamma);
 
     return 0;
   }
 };
 
+// Explicit leapfrog time integrator, which defers to the time-dependent operator for the
+// update using the lumped mass matrix.
+class LeapfrogSolver : public mfem::ODESolver
+{
+public:
+  void Step(Vector &x, double &t, double &dt) override
+  {
+    static_cast<TimeDependentFirstOrderOperator *>(f)->LeapfrogStep(x, t, dt);
+    t += dt;
+  }
+};
+
 }  // namespace
 
 TimeOperator::TimeOperator(const IoData &iodata, SpaceOperator &space_op,
@@ -286,30 +446,37 @@ TimeOperator::TimeOperator(const IoData &iodata, SpaceOperator &space_op,
   : rel_tol(iodata.solver.transient.rel_tol), abs_tol(iodata.solver.transient.abs_tol),
     order(iodata.solver.transient.order)
 {
-  auto excitation_helper = space_op.GetPortExcitations();
-  // Should have already asserted that time dependant solver only has a single excitation.
-  MFEM_VERIFY(excitation_helper.Size() == 1,
-              fmt::format("Transient evolution currently only allows for a single "
-                          "excitation, received {}",
-                          excitation_helper.Size()));
-
   // Get sizes.
   int size_E = space_op.GetNDSpace().GetTrueVSize();
   int size_B = space_op.GetRTSpace().GetTrueVSize();
+  int n_ex = space_op.GetPortExcitations().Size();
 
-  // Allocate space for solution vectors.
-  sol.SetSize(2 * size_E + size_B);
+  // Allocate space for solution vectors, with one column for each excitation.
+  sol.SetSize(n_ex * (2 * size_E + size_B));
   sol.UseDevice(true);
-  E.UseDevice(true);
-  B.UseDevice(true);
   sol.ReadWrite();
-  E.MakeRef(sol, size_E, size_E);
-  B.MakeRef(sol, 2 * size_E, size_B);
+  E.resize(n_ex);
+  B.resize(n_ex);
+  for (int c = 0; c < n_ex; c++)
+  {
+    E[c].UseDevice(true);
+    B[c].UseDevice(true);
+    E[c].MakeRef(sol, c * (2 * size_E + size_B) + size_E, size_E);
+    B[c].MakeRef(sol, c * (2 * size_E + size_B) + 2 * size_E, size_B);
+  }
 
   // Create ODE solver for 1st-order IVP.
-  mfem::TimeDependentOperator::Type type = mfem::TimeDependentOperator::IMPLICIT;
+  mfem::TimeDependentOperator::Type type = iodata.solver.transient.leapfrog
+                                               ? mfem::TimeDependentOperator::EXPLICIT
+                                               : mfem::TimeDependentOperator::IMPLICIT;
   op = std::make_unique<TimeDependentFirstOrderOperator>(iodata, space_op, dJ_coef, 0.0,
                                                          type);
+  if (iodata.solver.transient.leapfrog)
+  {
+    use_mfem_integrator = true;
+    ode = std::make_unique<LeapfrogSolver>();
+    return;
+  }
   switch (iodata.solver.transient.type)
   {
     case TimeSteppingScheme::GEN_ALPHA:
@@ -387,6 +554,51 @@ const KspSolver &TimeOperator::GetLinearSolver() const
   return *first_order.kspA;
 }
 
+bool TimeOperator::HasLinearSolver() const
+{
+  const auto &first_order = dynamic_cast<const TimeDependentFirstOrderOperator &>(*op);
+  return (first_order.kspA != nullptr);
+}
+
+int TimeOperator::NumPreconditionerUpdates() const
+{
+  const auto &first_order = dynamic_cast<const TimeDependentFirstOrderOperator &>(*op);
+  return first_order.num_pc_update;
+}
+
+void TimeOperator::GetLumpedMassInverse(const Operator &M, Vector &Minv)
+{
+  // Absolute row-sum lumping, M_L = diag(|M| 1). The signs of the Nédélec basis functions
+  // depend on the edge and face orientations, so the plain row sums of M can vanish or
+  // change sign. The absolute row sums are positive, and M_L - M is diagonally dominant
+  // with a nonnegative diagonal, so M_L ≥ M. Thus λₘₐₓ(M_L⁻¹ K) ≤ λₘₐₓ(M⁻¹ K) and any time
+  // step stable with the consistent mass matrix is stable with the lumped one.
+  const auto *PtAP = dynamic_cast<const ParOperator *>(&M);
+  MFEM_VERIFY(PtAP, "Mass lumping requires the mass matrix as a ParOperator!");
+  Vector ones(M.Height());
+  ones.UseDevice(true);
+  ones = 1.0;
+  Minv.SetSize(M.Height());
+  Minv.UseDevice(true);
+  PtAP->ParallelAssemble().AbsMult(1.0, ones, 0.0, Minv);
+  Minv.Reciprocal();
+}
+
+double TimeOperator::GetLeapfrogTimeStepLimit(MPI_Comm comm, const Operator &K,
+                                              const Vector &Minv)
+{
+  // The stability limit is dt ≤ 2 / √λₘₐₓ(M_L⁻¹ K). M_L⁻¹ K is not symmetric, so the power
+  // iteration is applied to the similar symmetric operator M_L⁻¹ᐟ² K M_L⁻¹ᐟ².
+  Vector Minv_sqrt(Minv);
+  Minv_sqrt.UseDevice(true);
+  linalg::Sqrt(Minv_sqrt);
+  DiagonalOperator Dinv_sqrt(Minv_sqrt);
+  ProductOperator KD(K, Dinv_sqrt);
+  ProductOperator DKD(Dinv_sqrt, KD);
+  const double lam = linalg::SpectralNorm(comm, DKD, true);
+  return 2.0 / std::sqrt(lam);
+}
+
 void TimeOperator::Init()
 {
   // Always use zero initial conditions.
@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 #include <mfem.hpp>
 #include "linalg/ksp.hpp"
 #include "linalg/operator.hpp"
@@ -23,8 +24,10 @@ class SpaceOperator;
 class TimeOperator
 {
 private:
-  // Solution vector storage.
-  Vector E, B, sol;
+  // Solution vector storage. The state vector stores one [Edot, E, B] column for each
+  // excitation, and E and B reference the corresponding blocks of each column.
+  Vector sol;
+  std::vector<Vector> E, B;
 
   // Time integrator for the first order ODE system.
   std::unique_ptr<mfem::ODESolver> ode;
@@ -41,13 +44,24 @@ public:
   TimeOperator(const IoData &iodata, SpaceOperator &space_op,
                std::function<double(double)> dJ_coef);
 
-  // Access solution vectors for E- and B-fields.
-  const Vector &GetE() const { return E; }
-  const Vector &GetB() const { return B; }
+  // Access solution vectors for E- and B-fields for the given excitation column.
+  const Vector &GetE(int c = 0) const { return E[c]; }
+  const Vector &GetB(int c = 0) const { return B[c]; }
+
+  // Return the number of excitations integrated together in time.
+  int NumExcitations() const { return static_cast<int>(E.size()); }
 
   // Return the linear solver associated with the implicit or explicit time integrator.
   const KspSolver &GetLinearSolver() const;
 
+  // Return whether or not the time integrator uses a linear solver (the explicit leapfrog
+  // scheme with a lumped mass matrix does not).
+  bool HasLinearSolver() const;
+
+  // Return the number of times the preconditioner of the implicit time integrator has been
+  // constructed.
+  int NumPreconditionerUpdates() const;
+
   // Initialize time integrators and set 0 initial conditions.
   void Init();
 
@@ -56,6 +70,15 @@ public:
 
   // Print ODE integrator statistics.
   void PrintStats();
+
+  // Compute the inverse of the lumped (diagonal) mass matrix for the explicit leapfrog
+  // scheme, from a mass matrix which is a ParOperator.
+  static void GetLumpedMassInverse(const Operator &M, Vector &Minv);
+
+  // Estimate the (nondimensional) time step stability limit of the explicit leapfrog
+  // scheme for the stiffness matrix K and the inverse lumped mass matrix.
+  static double GetLeapfrogTimeStepLimit(MPI_Comm comm, const Operator &K,
+                                         const Vector &Minv);
 };
 
 }  // namespace palace
@@ -110,8 +110,8 @@ PALACE_JSON_SERIALIZE_ENUM(Excitation,
                             {Excitation::RAMP_STEP, "Ramp"},
                             {Excitation::SMOOTH_STEP, "SmoothStep"}})
 
-// Helper for converting string keys to enum for LinearSolver, KrylovSolver, and
-// MultigridCoarsening
+// Helper for converting string keys to enum for LinearSolver, KrylovSolver,
+// MultigridCoarsening, and MultigridCycle
 PALACE_JSON_SERIALIZE_ENUM(LinearSolver, {{LinearSolver::DEFAULT, "Default"},
                                           {LinearSolver::AMS, "AMS"},
                                           {LinearSolver::BOOMER_AMG, "BoomerAMG"},
@@ -129,6 +129,9 @@ PALACE_JSON_SERIALIZE_ENUM(KrylovSolver, {{KrylovSolver::DEFAULT, "Default"},
 PALACE_JSON_SERIALIZE_ENUM(MultigridCoarsening,
                            {{MultigridCoarsening::LINEAR, "Linear"},
                             {MultigridCoarsening::LOGARITHMIC, "Logarithmic"}})
+PALACE_JSON_SERIALIZE_ENUM(MultigridCycle, {{MultigridCycle::V_CYCLE, "V"},
+                                            {MultigridCycle::W_CYCLE, "W"},
+                                            {MultigridCycle::K_CYCLE, "K"}})
 
 // Helpers for converting string keys to enum for PreconditionerSide, SymbolicFactorization,
 // SparseCompression, and Orthogonalization.
@@ -347,6 +350,30 @@ void ProblemData::SetUp(json &config)
     output_formats.paraview = output_formats_it->value("Paraview", output_formats.paraview);
     output_formats.gridfunction =
         output_formats_it->value("GridFunction", output_formats.gridfunction);
+    output_formats.async_write =
+        output_formats_it->value("AsyncWrite", output_formats.async_write);
+    output_formats.precision =
+        output_formats_it->value("Precision", output_formats.precision);
+    output_formats.compression_level =
+        output_formats_it->value("CompressionLevel", output_formats.compression_level);
+    output_formats.fields = output_formats_it->value("Fields", output_formats.fields);
+    MFEM_VERIFY(output_formats.precision == 32 || output_formats.precision == 64,
+                "config[\"Problem\"][\"OutputFormats\"][\"Precision\"] must be 32 or "
+                "64!");
+    MFEM_VERIFY(output_formats.compression_level >= -1 &&
+                    output_formats.compression_level <= 9,
+                "config[\"Problem\"][\"OutputFormats\"][\"CompressionLevel\"] must be "
+                "between -1 and 9!");
+    for (const auto &field : output_formats.fields)
+    {
+      constexpr std::array valid = {"E",   "B", "V",   "A",   "U_e",
+                                    "U_m", "S", "Q_s", "J_s", "E0"};
+      MFEM_VERIFY(std::find(valid.begin(), valid.end(), field) != valid.end(),
+                  "Unknown field \"" << field
+                                     << "\" in config[\"Problem\"][\"OutputFormats\"]"
+                                        "[\"Fields\"]!");
+    }
+    output_formats.xdmf = output_formats_it->value("XDMF", output_formats.xdmf);
   }
 
   // Check for provided solver configuration data (not required for electrostatics or
@@ -402,6 +429,10 @@ void ProblemData::SetUp(json &config)
     std::cout << "Output: " << output << '\n';
     std::cout << "OutputFormats.Paraview: " << output_formats.paraview << '\n';
     std::cout << "OutputFormats.GridFunction: " << output_formats.gridfunction << '\n';
+    std::cout << "OutputFormats.Precision: " << output_formats.precision << '\n';
+    std::cout << "OutputFormats.CompressionLevel: " << output_formats.compression_level
+              << '\n';
+    std::cout << "OutputFormats.XDMF: " << output_formats.xdmf << '\n';
   }
 }
 
@@ -420,6 +451,7 @@ void RefinementData::SetUp(json &model)
   nonconformal = refinement->value("Nonconformal", nonconformal);
   max_nc_levels = refinement->value("MaxNCLevels", max_nc_levels);
   update_fraction = refinement->value("UpdateFraction", update_fraction);
+  coarsening_fraction = refinement->value("CoarseningFraction", coarsening_fraction);
   maximum_imbalance = refinement->value("MaximumImbalance", maximum_imbalance);
   save_adapt_iterations = refinement->value("SaveAdaptIterations", save_adapt_iterations);
   save_adapt_mesh = refinement->value("SaveAdaptMesh", save_adapt_mesh);
@@ -430,6 +462,11 @@ void RefinementData::SetUp(json &model)
               "config[\"Refinement\"][\"MaxNCLevels\"] must be non-negative!");
   MFEM_VERIFY(update_fraction > 0 && update_fraction < 1,
               "config[\"Refinement\"][\"UpdateFraction\" must be in (0,1)!");
+  MFEM_VERIFY(coarsening_fraction >= 0 && coarsening_fraction < 1,
+              "config[\"Refinement\"][\"CoarseningFraction\"] must be in [0,1)!");
+  MFEM_VERIFY(coarsening_fraction == 0.0 || nonconformal,
+              "config[\"Refinement\"][\"CoarseningFraction\"] requires nonconformal "
+              "adaptation!");
   MFEM_VERIFY(
       maximum_imbalance >= 1,
       "config[\"Refinement\"][\"MaximumImbalance\"] must be greater than or equal to 1!");
@@ -526,6 +563,7 @@ void RefinementData::SetUp(json &model)
   refinement->erase("Nonconformal");
   refinement->erase("MaxNCLevels");
   refinement->erase("UpdateFraction");
+  refinement->erase("CoarseningFraction");
   refinement->erase("MaximumImbalance");
   refinement->erase("SaveAdaptIterations");
   refinement->erase("SaveAdaptMesh");
@@ -546,6 +584,7 @@ void RefinementData::SetUp(json &model)
     std::cout << "Nonconformal: " << nonconformal << '\n';
     std::cout << "MaxNCLevels: " << max_nc_levels << '\n';
     std::cout << "UpdateFraction: " << update_fraction << '\n';
+    std::cout << "CoarseningFraction: " << coarsening_fraction << '\n';
     std::cout << "MaximumImbalance: " << maximum_imbalance << '\n';
     std::cout << "SaveAdaptIterations: " << save_adapt_iterations << '\n';
     std::cout << "SaveAdaptMesh: " << save_adapt_mesh << '\n';
@@ -2138,10 +2177,15 @@ void EigenSolverData::SetUp(json &solver)
   refine_nonlinear = eigenmode->value("RefineNonlinear", refine_nonlinear);
   linear_tol = eigenmode->value("LinearTol", linear_tol);
   target_upper = eigenmode->value("TargetUpper", target_upper);
+  n_slices = eigenmode->value("Slices", n_slices);
+  contour_n_points = eigenmode->value("ContourPoints", contour_n_points);
   preconditioner_lag = eigenmode->value("PreconditionerLag", preconditioner_lag);
   preconditioner_lag_tol = eigenmode->value("PreconditionerLagTol", preconditioner_lag_tol);
   max_restart = eigenmode->value("MaxRestart", max_restart);
 
+  MFEM_VERIFY(n_slices == 1 || target_upper > 0.0,
+              "config[\"Eigenmode\"][\"TargetUpper\"] must be specified for spectrum "
+              "slicing with config[\"Eigenmode\"][\"Slices\"] > 1!");
   target_upper = (target_upper < 0) ? 3 * target : target_upper;  // default = 3 * target
   MFEM_VERIFY(target > 0.0, "config[\"Eigenmode\"][\"Target\"] must be strictly positive!");
   MFEM_VERIFY(target_upper > target, "config[\"Eigenmode\"][\"TargetUpper\"] must be "
@@ -2154,6 +2198,7 @@ void EigenSolverData::SetUp(json &solver)
               "config[\"Eigenmode\"][\"MaxRestart\"] must be non-negative!");
 
   MFEM_VERIFY(n > 0, "\"N\" must be greater than 0!");
+  MFEM_VERIFY(n_slices > 0, "config[\"Eigenmode\"][\"Slices\"] must be positive!");
 
   // Cleanup
   eigenmode->erase("Target");
@@ -2172,6 +2217,8 @@ void EigenSolverData::SetUp(json &solver)
   eigenmode->erase("RefineNonlinear");
   eigenmode->erase("LinearTol");
   eigenmode->erase("TargetUpper");
+  eigenmode->erase("Slices");
+  eigenmode->erase("ContourPoints");
   eigenmode->erase("PreconditionerLag");
   eigenmode->erase("PreconditionerLagTol");
   eigenmode->erase("MaxRestart");
@@ -2198,6 +2245,8 @@ void EigenSolverData::SetUp(json &solver)
     std::cout << "RefineNonlinear: " << refine_nonlinear << '\n';
     std::cout << "LinearTol: " << linear_tol << '\n';
     std::cout << "TargetUpper: " << target_upper << '\n';
+    std::cout << "Slices: " << n_slices << '\n';
+    std::cout << "ContourPoints: " << contour_n_points << '\n';
     std::cout << "PreconditionerLag: " << preconditioner_lag << '\n';
     std::cout << "PreconditionerLagTol: " << preconditioner_lag_tol << '\n';
     std::cout << "MaxRestart: " << max_restart << '\n';
@@ -2269,12 +2318,53 @@ void TransientSolverData::SetUp(json &solver)
   max_t = transient->at("MaxTime");     // Required
   delta_t = transient->at("TimeStep");  // Required
   delta_post = transient->value("SaveStep", delta_post);
+  delta_measure = transient->value("MeasureStep", delta_measure);
+  delta_estimate = transient->value("EstimatorStep", delta_estimate);
+  estimator_min_t = transient->value("EstimatorMinTime", estimator_min_t);
+  estimator_max_t = transient->value("EstimatorMaxTime", max_t);
   order = transient->value("Order", order);
   rel_tol = transient->value("RelTol", rel_tol);
   abs_tol = transient->value("AbsTol", abs_tol);
+  pc_update_ratio = transient->value("PCUpdateRatio", pc_update_ratio);
+  pc_update_it = transient->value("PCUpdateIterFactor", pc_update_it);
+  leapfrog = transient->value("Leapfrog", leapfrog);
+  dft_f = transient->value("DFTFreqs", dft_f);
+  dft_save_fields = transient->value("DFTSaveFields", dft_save_fields);
+  MFEM_VERIFY(std::all_of(dft_f.begin(), dft_f.end(), [](double f) { return f > 0.0; }),
+              "config[\"Transient\"][\"DFTFreqs\"] must contain only positive "
+              "frequencies!");
+  MFEM_VERIFY(!dft_save_fields || !dft_f.empty(),
+              "config[\"Transient\"][\"DFTSaveFields\"] requires "
+              "config[\"Transient\"][\"DFTFreqs\"]!");
   MFEM_VERIFY(delta_t > 0, "\"TimeStep\" must be greater than 0.0!");
-
-  if (type == TimeSteppingScheme::GEN_ALPHA || type == TimeSteppingScheme::RUNGE_KUTTA)
+  MFEM_VERIFY(pc_update_ratio >= 1.0,
+              "config[\"Transient\"][\"PCUpdateRatio\"] must be at least 1.0!");
+  MFEM_VERIFY(pc_update_it >= 1.0,
+              "config[\"Transient\"][\"PCUpdateIterFactor\"] must be at least 1.0!");
+  MFEM_VERIFY(delta_measure > 0, "\"MeasureStep\" must be greater than 0!");
+  MFEM_VERIFY(delta_estimate > 0, "\"EstimatorStep\" must be greater than 0!");
+  MFEM_VERIFY(estimator_min_t >= 0.0 && estimator_min_t <= estimator_max_t &&
+                  estimator_min_t <= max_t,
+              "\"EstimatorMinTime\" and \"EstimatorMaxTime\" must define a nonempty time "
+              "window within [0.0, \"MaxTime\"]!");
+
+  if (leapfrog)
+  {
+    if (transient->contains("Type"))
+    {
+      MFEM_WARNING("config[\"Transient\"][\"Type\"] is ignored when using the explicit "
+                   "leapfrog transient solver!");
+    }
+    if (transient->contains("Order") || transient->contains("RelTol") ||
+        transient->contains("AbsTol"))
+    {
+      MFEM_WARNING("Leapfrog transient solver does not use\n"
+                   "config[\"Transient\"][\"Order\"], "
+                   "config[\"Transient\"][\"RelTol\"], or\n"
+                   "config[\"Transient\"][\"AbsTol\"]!");
+    }
+  }
+  else if (type == TimeSteppingScheme::GEN_ALPHA || type == TimeSteppingScheme::RUNGE_KUTTA)
   {
     if (transient->contains("Order"))
     {
@@ -2306,9 +2396,18 @@ void TransientSolverData::SetUp(json &solver)
   transient->erase("MaxTime");
   transient->erase("TimeStep");
   transient->erase("SaveStep");
+  transient->erase("MeasureStep");
+  transient->erase("EstimatorStep");
+  transient->erase("EstimatorMinTime");
+  transient->erase("EstimatorMaxTime");
   transient->erase("Order");
   transient->erase("RelTol");
   transient->erase("AbsTol");
+  transient->erase("PCUpdateRatio");
+  transient->erase("PCUpdateIterFactor");
+  transient->erase("Leapfrog");
+  transient->erase("DFTFreqs");
+  transient->erase("DFTSaveFields");
   MFEM_VERIFY(transient->empty(),
               "Found an unsupported configuration file keyword under \"Transient\"!\n"
                   << transient->dump(2));
@@ -2323,9 +2422,18 @@ void TransientSolverData::SetUp(json &solver)
     std::cout << "MaxTime: " << max_t << '\n';
     std::cout << "TimeStep: " << delta_t << '\n';
     std::cout << "SaveStep: " << delta_post << '\n';
+    std::cout << "MeasureStep: " << delta_measure << '\n';
+    std::cout << "EstimatorStep: " << delta_estimate << '\n';
+    std::cout << "EstimatorMinTime: " << estimator_min_t << '\n';
+    std::cout << "EstimatorMaxTime: " << estimator_max_t << '\n';
     std::cout << "Order: " << order << '\n';
     std::cout << "RelTol: " << rel_tol << '\n';
     std::cout << "AbsTol: " << abs_tol << '\n';
+    std::cout << "PCUpdateRatio: " << pc_update_ratio << '\n';
+    std::cout << "PCUpdateIterFactor: " << pc_update_it << '\n';
+    std::cout << "Leapfrog: " << leapfrog << '\n';
+    std::cout << "DFTFreqs: " << dft_f << '\n';
+    std::cout << "DFTSaveFields: " << dft_save_fields << '\n';
   }
 }
 
@@ -2341,6 +2449,9 @@ void LinearSolverData::SetUp(json &solver)
   tol = linear->value("Tol", tol);
   max_it = linear->value("MaxIts", max_it);
   max_size = linear->value("MaxSize", max_size);
+  recycle_size = linear->value("RecycleSize", recycle_size);
+  MFEM_VERIFY(recycle_size >= 0,
+              "config[\"Linear\"][\"RecycleSize\"] must be non-negative!");
   initial_guess = linear->value("InitialGuess", initial_guess);
 
   // Options related to multigrid.
@@ -2348,6 +2459,7 @@ void LinearSolverData::SetUp(json &solver)
   mg_coarsening = linear->value("MGCoarsenType", mg_coarsening);
   mg_use_mesh = linear->value("MGUseMesh", mg_use_mesh);
   mg_cycle_it = linear->value("MGCycleIts", mg_cycle_it);
+  mg_cycle_type = linear->value("MGCycleType", mg_cycle_type);
   mg_smooth_aux = linear->value("MGAuxiliarySmoother", mg_smooth_aux);
   mg_smooth_it = linear->value("MGSmoothIts", mg_smooth_it);
   mg_smooth_order = linear->value("MGSmoothOrder", mg_smooth_order);
@@ -2358,6 +2470,7 @@ void LinearSolverData::SetUp(json &solver)
   // Preconditioner-specific options.
   pc_mat_real = linear->value("PCMatReal", pc_mat_real);
   pc_mat_shifted = linear->value("PCMatShifted", pc_mat_shifted);
+  pc_mat_lor = linear->value("PCLowOrderRefined", pc_mat_lor);
   complex_coarse_solve = linear->value("ComplexCoarseSolve", complex_coarse_solve);
   drop_small_entries = linear->value("DropSmallEntries", drop_small_entries);
   reorder_reuse = linear->value("ReorderingReuse", reorder_reuse);
@@ -2380,6 +2493,11 @@ void LinearSolverData::SetUp(json &solver)
   estimator_tol = linear->value("EstimatorTol", estimator_tol);
   estimator_max_it = linear->value("EstimatorMaxIts", estimator_max_it);
   estimator_mg = linear->value("EstimatorMG", estimator_mg);
+  estimator_initial_guess =
+      linear->value("EstimatorInitialGuess", estimator_initial_guess);
+  estimator_adaptive_tol = linear->value("EstimatorAdaptiveTol", estimator_adaptive_tol);
+  MFEM_VERIFY(estimator_initial_guess >= 0 && estimator_initial_guess <= 2,
+              "config[\"Linear\"][\"EstimatorInitialGuess\"] must be 0, 1, or 2!");
   gs_orthog = linear->value("GSOrthogonalization", gs_orthog);
 
   // Cleanup
@@ -2388,12 +2506,14 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("Tol");
   linear->erase("MaxIts");
   linear->erase("MaxSize");
+  linear->erase("RecycleSize");
   linear->erase("InitialGuess");
 
   linear->erase("MGMaxLevels");
   linear->erase("MGCoarsenType");
   linear->erase("MGUseMesh");
   linear->erase("MGCycleIts");
+  linear->erase("MGCycleType");
   linear->erase("MGAuxiliarySmoother");
   linear->erase("MGSmoothIts");
   linear->erase("MGSmoothOrder");
@@ -2403,6 +2523,7 @@ void LinearSolverData::SetUp(json &solver)
 
   linear->erase("PCMatReal");
   linear->erase("PCMatShifted");
+  linear->erase("PCLowOrderRefined");
   linear->erase("ComplexCoarseSolve");
   linear->erase("DropSmallEntries");
   linear->erase("ReorderingReuse");
@@ -2422,6 +2543,8 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("EstimatorTol");
   linear->erase("EstimatorMaxIts");
   linear->erase("EstimatorMG");
+  linear->erase("EstimatorInitialGuess");
+  linear->erase("EstimatorAdaptiveTol");
   linear->erase("GSOrthogonalization");
   MFEM_VERIFY(linear->empty(),
               "Found an unsupported configuration file keyword under \"Linear\"!\n"
@@ -2435,12 +2558,14 @@ void LinearSolverData::SetUp(json &solver)
     std::cout << "Tol: " << tol << '\n';
     std::cout << "MaxIts: " << max_it << '\n';
     std::cout << "MaxSize: " << max_size << '\n';
+    std::cout << "RecycleSize: " << recycle_size << '\n';
     std::cout << "InitialGuess: " << initial_guess << '\n';
 
     std::cout << "MGMaxLevels: " << mg_max_levels << '\n';
     std::cout << "MGCoarsenType: " << mg_coarsening << '\n';
     std::cout << "MGUseMesh: " << mg_use_mesh << '\n';
     std::cout << "MGCycleIts: " << mg_cycle_it << '\n';
+    std::cout << "MGCycleType: " << mg_cycle_type << '\n';
     std::cout << "MGAuxiliarySmoother: " << mg_smooth_aux << '\n';
     std::cout << "MGSmoothIts: " << mg_smooth_it << '\n';
     std::cout << "MGSmoothOrder: " << mg_smooth_order << '\n';
@@ -2450,6 +2575,7 @@ void LinearSolverData::SetUp(json &solver)
 
     std::cout << "PCMatReal: " << pc_mat_real << '\n';
     std::cout << "PCMatShifted: " << pc_mat_shifted << '\n';
+    std::cout << "PCLowOrderRefined: " << pc_mat_lor << '\n';
     std::cout << "ComplexCoarseSolve: " << complex_coarse_solve << '\n';
     std::cout << "DropSmallEntries: " << drop_small_entries << '\n';
     std::cout << "ReorderingReuse: " << reorder_reuse << '\n';
@@ -2469,6 +2595,8 @@ void LinearSolverData::SetUp(json &solver)
     std::cout << "EstimatorTol: " << estimator_tol << '\n';
     std::cout << "EstimatorMaxIts: " << estimator_max_it << '\n';
     std::cout << "EstimatorMG: " << estimator_mg << '\n';
+    std::cout << "EstimatorInitialGuess: " << estimator_initial_guess << '\n';
+    std::cout << "EstimatorAdaptiveTol: " << estimator_adaptive_tol << '\n';
     std::cout << "GSOrthogonalization: " << gs_orthog << '\n';
   }
 }
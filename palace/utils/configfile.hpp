@@ -12,6 +12,19 @@
 #include <nlohmann/json_fwd.hpp>
 #include "labels.hpp"
 
+namespace palace
+{
+
+// Cycle type for geometric multigrid preconditioners.
+enum class MultigridCycle
+{
+  V_CYCLE,
+  W_CYCLE,
+  K_CYCLE
+};
+
+}  // namespace palace
+
 namespace palace::config
 {
 
@@ -99,6 +112,23 @@ public:
 
   // Enable MFEM GLVis grid function output format.
   bool gridfunction = false;
+
+  // Write Paraview output asynchronously on a background thread.
+  bool async_write = false;
+
+  // Floating point precision (32 or 64 bits) for Paraview, grid function, and XDMF output.
+  int precision = 32;
+
+  // Compression level for Paraview and grid function output (-1 for the default level of
+  // each format, 0 to disable, or 1 to 9). By default, Paraview output is compressed and
+  // grid function output is not.
+  int compression_level = -1;
+
+  // Names of the fields to output (all available fields if empty).
+  std::vector<std::string> fields = {};
+
+  // Enable aggregated XDMF output format (single binary files written collectively).
+  bool xdmf = false;
 };
 
 struct ProblemData
@@ -164,6 +194,11 @@ public:
   // update_fraction of the total error.
   double update_fraction = 0.7;
 
+  // Dörfler coarsening fraction. The set of derefinement opportunities to coarsen is the
+  // largest set that contains at most coarsening_fraction of the total error. Zero
+  // disables coarsening, which requires nonconformal adaptation.
+  double coarsening_fraction = 0.0;
+
   // Maximum allowable ratio of number of elements across processors before rebalancing is
   // performed.
   double maximum_imbalance = 1.1;
@@ -753,10 +788,19 @@ public:
   // eigenvalue solver used to generate the initial guess.
   double linear_tol = 1e-3;
 
-  // Upper end of the target range for nonlinear eigenvalue solver [GHz]. A value <0
-  // will use the default (3 * target).
+  // Upper end of the target range for nonlinear eigenvalue solver and spectrum slicing
+  // [GHz]. A value <0 will use the default (3 * target).
   double target_upper = -1;
 
+  // Number of spectrum slices into which the target range is split, each solved with its
+  // own shift-and-invert target.
+  int n_slices = 1;
+
+  // Number of quadrature points for the contour-integral eigenvalue solver, which computes
+  // all eigenvalues in the target range. A value <1 uses the shift-and-invert eigenvalue
+  // solver specified by type.
+  int contour_n_points = 0;
+
   // Update frequency of the preconditioner in the quasi-Newton nonlinear eigenvalue solver.
   int preconditioner_lag = 10;
 
@@ -811,6 +855,14 @@ public:
   // Step increment for saving fields to disk.
   int delta_post = 0;
 
+  // Step increment for full postprocessing measurements (ports are measured every step).
+  int delta_measure = 1;
+
+  // Step increment and time window [ns] for error estimation.
+  int delta_estimate = 1;
+  double estimator_min_t = 0.0;
+  double estimator_max_t = 1.0;
+
   // RK scheme order for SUNDIALS ARKODE integrators.
   // Max order for SUNDIALS CVODE integrator.
   // Not used for generalized α and Runge-Kutta integrators.
@@ -820,6 +872,22 @@ public:
   double rel_tol = 1e-4;
   double abs_tol = 1e-9;
 
+  // Policy for reusing the preconditioner of the implicit time integrators when the time
+  // step changes: it is only rebuilt when the time step differs from the one it was built
+  // for by more than the given ratio, or when the linear solver iterations grow beyond the
+  // given factor times those of the first solve with it.
+  double pc_update_ratio = 1.5;
+  double pc_update_it = 2.0;
+
+  // Use the explicit leapfrog scheme with a lumped mass matrix instead of the integrator
+  // specified by the type.
+  bool leapfrog = false;
+
+  // Frequencies [GHz] at which to compute running discrete Fourier transforms of the port
+  // signals, and whether to also transform and save the fields.
+  std::vector<double> dft_f = {};
+  bool dft_save_fields = false;
+
   void SetUp(json &solver);
 };
 
@@ -841,6 +909,10 @@ public:
   // Maximum Krylov space dimension for GMRES/FGMRES iterative solvers.
   int max_size = -1;
 
+  // Dimension of the subspace recycled across restarts and solves for the GMRES iterative
+  // solver (GCRO-DR). Zero disables recycling.
+  int recycle_size = 0;
+
   // Reuse previous solution as initial guess for Krylov solvers.
   int initial_guess = -1;
 
@@ -858,6 +930,10 @@ public:
   // number of V-cycles per Krylov solver iteration.
   int mg_cycle_it = 1;
 
+  // Cycle type for geometric multigrid. The K-cycle accelerates each coarse-level
+  // correction with Krylov iterations preconditioned by the cycle on that level.
+  MultigridCycle mg_cycle_type = MultigridCycle::V_CYCLE;
+
   // Use auxiliary space smoothers on geometric multigrid levels.
   int mg_smooth_aux = -1;
 
@@ -885,6 +961,10 @@ public:
   // (makes the preconditioner matrix SPD).
   int pc_mat_shifted = -1;
 
+  // For frequency and time domain applications, assemble the coarsest level of the
+  // preconditioner on the low-order-refined (LOR) discretization of the space.
+  bool pc_mat_lor = false;
+
   // For frequency domain applications, use the complex-valued system matrix in the sparse
   // direct solver.
   bool complex_coarse_solve = false;
@@ -941,6 +1021,14 @@ public:
   // of just Jacobi).
   bool estimator_mg = false;
 
+  // Initial guess for error estimator linear solves (0: zero, 1: previous solution, 2:
+  // linear extrapolation from the two previous solutions).
+  int estimator_initial_guess = 0;
+
+  // Adapt the error estimator linear solver tolerance to the estimated error, using
+  // estimator_tol as the minimum tolerance.
+  bool estimator_adaptive_tol = false;
+
   // Enable different variants of Gram-Schmidt orthogonalization for GMRES/FGMRES iterative
   // solvers and SLEPc eigenvalue solver.
   Orthogonalization gs_orthog = Orthogonalization::MGS;
@@ -19,6 +19,7 @@
 #include "fem/interpolator.hpp"
 #include "utils/communication.hpp"
 #include "utils/diagnostic.hpp"
+#include "utils/dorfler.hpp"
 #include "utils/filesystem.hpp"
 #include "utils/meshio.hpp"
 #include "utils/omp.hpp"
@@ -69,7 +70,8 @@ std::unique_ptr<int[]> GetMeshPartitioning(const mfem::Mesh &, int,
 // Given a serial mesh on the root processor and element partitioning, create a parallel
 // mesh over the given communicator. The serial mesh is destroyed when no longer needed.
 std::unique_ptr<mfem::ParMesh> DistributeMesh(MPI_Comm, std::unique_ptr<mfem::Mesh> &,
-                                              const int *, const std::string & = "");
+                                              const int *, const std::string & = "",
+                                              bool = true);
 
 // Rebalance a conformal mesh across processor ranks, using the MeshPartitioner. Gathers the
 // mesh onto the root rank before scattering the partitioned mesh.
@@ -1421,6 +1423,109 @@ double RebalanceMesh(const IoData &iodata, std::unique_ptr<mfem::ParMesh> &mesh)
   return ratio;
 }
 
+int CoarsenMesh(mfem::ParMesh &mesh, mfem::Vector &e, double fraction, int max_nc_levels)
+{
+  MPI_Comm comm = mesh.GetComm();
+  int num_opportunities = mesh.pncmesh->GetDerefinementTable().Size();
+  Mpi::GlobalSum(1, &num_opportunities, comm);
+  if (num_opportunities == 0)
+  {
+    return 0;
+  }
+
+  // The threshold marks the derefinement opportunities which carry at least (1 - θ) of the
+  // error, so the remaining ones are coarsened. Derefinement sums the squared estimates of
+  // the children and compares against the squared threshold, which is reduced slightly so
+  // that opportunities with error equal to the threshold are kept despite rounding.
+  const auto [threshold, kept_error] =
+      utils::ComputeDorflerCoarseningThreshold(mesh, e, fraction);
+  const double threshold2 =
+      threshold * threshold * (1.0 - 8.0 * std::numeric_limits<double>::epsilon());
+  mfem::Vector e2(e.Size());
+  for (int i = 0; i < e.Size(); i++)
+  {
+    e2[i] = e[i] * e[i];
+  }
+
+  // Carry the estimates over to the coarsened mesh as a piecewise constant density of the
+  // squared error, for which the L² projection onto the parent sums the children.
+  mfem::L2_FECollection fec(0, mesh.Dimension());
+  mfem::ParFiniteElementSpace fespace(&mesh, &fec);
+  mfem::ParGridFunction density(&fespace);
+  for (int i = 0; i < mesh.GetNE(); i++)
+  {
+    density(i) = e2[i] / mesh.GetElementVolume(i);
+  }
+  const auto initial_elem_count = mesh.GetGlobalNE();
+  if (!mesh.DerefineByError(e2, threshold2, max_nc_levels, 1))
+  {
+    return 0;
+  }
+  fespace.Update();
+  density.Update();
+  e.SetSize(mesh.GetNE());
+  for (int i = 0; i < mesh.GetNE(); i++)
+  {
+    e[i] = std::sqrt(std::max(density(i), 0.0) * mesh.GetElementVolume(i));
+  }
+  const auto final_elem_count = mesh.GetGlobalNE();
+  Mpi::Print(" Nonconforming mesh coarsening removed {:d} elements (initial = {:d}, "
+             "final = {:d}, {:.2f}% of the error, θ = {:.2f})\n",
+             initial_elem_count - final_elem_count, initial_elem_count, final_elem_count,
+             100 * (1.0 - kept_error), fraction);
+  return static_cast<int>(initial_elem_count - final_elem_count);
+}
+
+std::unique_ptr<mfem::ParMesh> DistributeMeshToGroup(const mfem::ParMesh &mesh,
+                                                     MPI_Comm group_comm,
+                                                     const std::vector<int> &part)
+{
+  MPI_Comm comm = mesh.GetComm();
+  MFEM_VERIFY(mesh.Conforming(),
+              "Copying a mesh onto a process group requires a conformal mesh!");
+  MFEM_VERIFY(static_cast<int>(part.size()) == Mpi::Size(comm),
+              "Invalid partitioning for copying a mesh onto a process group!");
+
+  // Find the roots of all groups, as ranks of the original communicator.
+  int group_root = Mpi::Rank(comm);
+  Mpi::Broadcast(1, &group_root, 0, group_comm);
+  std::vector<int> roots(Mpi::Size(comm)), ne(Mpi::Size(comm));
+  MPI_Allgather(&group_root, 1, MPI_INT, roots.data(), 1, MPI_INT, comm);
+  std::sort(roots.begin(), roots.end());
+  roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+  const int loc_ne = mesh.GetNE();
+  MPI_Allgather(&loc_ne, 1, MPI_INT, ne.data(), 1, MPI_INT, comm);
+
+  // Gather the serial mesh on the root of each group in turn. Its elements are ordered by
+  // process and then by local index, which gives the partitioning. Without access to a
+  // refinement tree, this does not work for nonconformal meshes.
+  constexpr bool generate_bdr = false, refine = false, fix_orientation = false;
+  std::unique_ptr<mfem::Mesh> smesh;
+  for (auto root : roots)
+  {
+    mfem::Mesh root_mesh = mesh.GetSerialMesh(root);
+    if (Mpi::Rank(comm) == root)
+    {
+      smesh = std::make_unique<mfem::Mesh>(std::move(root_mesh));
+    }
+  }
+  std::unique_ptr<int[]> partitioning;
+  if (smesh)
+  {
+    smesh->FinalizeTopology(generate_bdr);
+    smesh->Finalize(refine, fix_orientation);
+    partitioning = std::make_unique<int[]>(smesh->GetNE());
+    for (int p = 0, e = 0; p < Mpi::Size(comm); p++)
+    {
+      for (int i = 0; i < ne[p]; i++)
+      {
+        partitioning[e++] = part[p];
+      }
+    }
+  }
+  return DistributeMesh(group_comm, smesh, partitioning.get(), "", refine);
+}
+
 }  // namespace mesh
 
 namespace
@@ -2681,14 +2786,14 @@ std::unique_ptr<int[]> GetMeshPartitioning(const mfem::Mesh &mesh, int size,
 std::unique_ptr<mfem::ParMesh> DistributeMesh(MPI_Comm comm,
                                               std::unique_ptr<mfem::Mesh> &smesh,
                                               const int *partitioning,
-                                              const std::string &output_dir)
+                                              const std::string &output_dir, bool refine)
 {
   // Take a serial mesh and partitioning on the root process and construct the global
   // parallel mesh. For now, prefer the MPI-based version to the file IO one. When
   // constructing the ParMesh, we mark for refinement since refinement flags are not copied
   // from the serial mesh. Beware that mfem::ParMesh constructor argument order is not the
   // same as mfem::Mesh! Each processor's component gets sent as a byte string.
-  constexpr bool generate_edges = false, refine = true, fix_orientation = false;
+  constexpr bool generate_edges = false, fix_orientation = false;
   std::unique_ptr<mfem::ParMesh> pmesh;
   if (Mpi::Root(comm))
   {
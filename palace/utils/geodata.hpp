@@ -238,6 +238,20 @@ inline double GetVolume(const mfem::ParMesh &mesh, int attr)
 // the intermediate stages to disk. Returns the imbalance ratio before rebalancing.
 double RebalanceMesh(const IoData &iodata, std::unique_ptr<mfem::ParMesh> &mesh);
 
+// Coarsen a nonconforming mesh by derefining the largest set of derefinement opportunities
+// which make up at most the given fraction of the total error, and transfer the error
+// estimates to the coarsened mesh. Returns the reduction in the global number of elements.
+int CoarsenMesh(mfem::ParMesh &mesh, mfem::Vector &e, double fraction, int max_nc_levels);
+
+// Copy a conformal parallel mesh onto each group of processes of a split communicator, so
+// that every group holds the full mesh. The elements of process p of the original
+// communicator are kept together, in their local order, on process part[p] of the group.
+// Tetrahedra are not marked for refinement again, so each element keeps its vertex
+// ordering and element-local degrees of freedom agree between the two meshes.
+std::unique_ptr<mfem::ParMesh> DistributeMeshToGroup(const mfem::ParMesh &mesh,
+                                                     MPI_Comm group_comm,
+                                                     const std::vector<int> &part);
+
 // Helper for creating a hexahedral mesh from a tetrahedral mesh.
 mfem::Mesh MeshTetToHex(const mfem::Mesh &orig_mesh);
 
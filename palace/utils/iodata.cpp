@@ -355,6 +355,12 @@ void IoData::CheckConfiguration()
   {
     solver.linear.max_size = solver.linear.max_it;
   }
+  if (solver.linear.mg_cycle_type == MultigridCycle::K_CYCLE &&
+      solver.linear.krylov_solver != KrylovSolver::FGMRES)
+  {
+    Mpi::Warning("Multigrid K-cycle results in a nonlinear preconditioner, consider using "
+                 "\"FGMRES\" for config[\"Solver\"][\"Linear\"][\"KSPType\"]!\n");
+  }
   if (solver.linear.initial_guess < 0)
   {
     if ((problem.type == ProblemType::DRIVEN && solver.driven.adaptive_tol <= 0.0) ||
@@ -559,6 +565,12 @@ void IoData::NondimensionalizeInputs(mfem::ParMesh &mesh)
   solver.transient.pulse_tau /= units.GetScaleFactor<Units::ValueType::TIME>();
   solver.transient.max_t /= units.GetScaleFactor<Units::ValueType::TIME>();
   solver.transient.delta_t /= units.GetScaleFactor<Units::ValueType::TIME>();
+  solver.transient.estimator_min_t /= units.GetScaleFactor<Units::ValueType::TIME>();
+  solver.transient.estimator_max_t /= units.GetScaleFactor<Units::ValueType::TIME>();
+  for (auto &f : solver.transient.dft_f)
+  {
+    f /= units.GetScaleFactor<Units::ValueType::FREQUENCY>();
+  }
 
   // Scale mesh vertices for correct nondimensionalization.
   mesh::NondimensionalizeMesh(mesh, units.GetMeshLengthRelativeScale());
@@ -48,6 +48,7 @@ public:
     POSTPRO_FARFIELD,      // Computing far-fields
     POSTPRO_PARAVIEW,      // Paraview calculations and I/O
     POSTPRO_GRIDFUNCTION,  // MFEM gridfunction calculations and I/O
+    POSTPRO_XDMF,          // XDMF calculations and I/O
     IO,                    // Disk I/O
     TOTAL,
     NUM_TIMINGS
@@ -77,6 +78,7 @@ public:
       "  Far Fields",
       "  Paraview",
       "  Grid function",
+      "  XDMF",
       "Disk IO",
       "Total"};
   // clang-format on
@@ -0,0 +1,137 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "linalg/beyn.hpp"
+#include "linalg/iterative.hpp"
+#include "linalg/jacobi.hpp"
+#include "linalg/ksp.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+using namespace Catch::Matchers;
+
+namespace
+{
+
+// Diagonal quadratic eigenvalue problem P(λ) = K + λ C + λ² M with K = diag(k_i),
+// C = c I, and M = I, which has eigenvalues λ = -c/2 ± i √(k_i - c²/4). For c = 0 this is
+// the generalized problem K x = -λ² M x.
+struct DiagonalQep
+{
+  Vector k, c, m;
+
+  DiagonalQep(int n, double damping) : k(n), c(n), m(n)
+  {
+    for (int i = 0; i < n; i++)
+    {
+      k(i) = (i + 1.0) * (i + 1.0);
+    }
+    c = damping;
+    m = 1.0;
+  }
+
+  // Returns the complex diagonal operator a0 K + a1 C + a2 M.
+  std::unique_ptr<ComplexOperator> GetOperator(std::complex<double> a0,
+                                               std::complex<double> a1,
+                                               std::complex<double> a2) const
+  {
+    Vector dr(k.Size()), di(k.Size());
+    for (int i = 0; i < k.Size(); i++)
+    {
+      const std::complex<double> d = a0 * k(i) + a1 * c(i) + a2 * m(i);
+      dr(i) = d.real();
+      di(i) = d.imag();
+    }
+    return std::make_unique<ComplexWrapperOperator>(
+        std::make_unique<mfem::SparseMatrix>(dr), std::make_unique<mfem::SparseMatrix>(di));
+  }
+};
+
+std::unique_ptr<ComplexOperator> GetRealDiagonal(const Vector &d)
+{
+  return std::make_unique<ComplexWrapperOperator>(std::make_unique<mfem::SparseMatrix>(d),
+                                                  nullptr);
+}
+
+void CheckBeyn(MPI_Comm comm, double damping)
+{
+  // With K = diag((i + 1)²), the eigenvalues in the upper half plane have imaginary parts
+  // close to 1, 2, 3, ..., and the contour encloses exactly the ones near 2i, 3i, and 4i.
+  constexpr int n = 40, nev = 3;
+  DiagonalQep qep(n, damping);
+  auto K = GetRealDiagonal(qep.k), C = GetRealDiagonal(qep.c), M = GetRealDiagonal(qep.m);
+  const std::complex<double> center(-0.5 * damping, 3.0);
+
+  // The diagonal preconditioner is exact, so GMRES converges in a single iteration.
+  auto gmres = std::make_unique<GmresSolver<ComplexOperator>>(comm, 0);
+  gmres->SetRelTol(1.0e-12);
+  gmres->SetMaxIter(10);
+  auto pc = std::make_unique<JacobiSmoother<ComplexOperator>>(comm);
+  ComplexKspSolver ksp(std::move(gmres), std::move(pc));
+
+  BeynSolver eigen(comm, 0);
+  if (damping > 0.0)
+  {
+    eigen.SetOperators(*K, *C, *M, EigenvalueSolver::ScaleType::NONE);
+  }
+  else
+  {
+    eigen.SetOperators(*K, *M, EigenvalueSolver::ScaleType::NONE);
+  }
+  eigen.SetSystemMatrixUpdate([&](std::complex<double> z)
+                              { return qep.GetOperator(1.0, z, z * z); });
+  eigen.SetPreconditionerUpdate(
+      [&](std::complex<double> a0, std::complex<double> a1, std::complex<double> a2, double)
+      { return qep.GetOperator(a0, a1, a2); });
+  eigen.SetLinearSolver(ksp);
+  eigen.SetNumModes(nev);
+  eigen.SetTol(1.0e-8);
+  eigen.SetContour(center, 0.5, 1.5, 32);
+
+  const int num_conv = eigen.Solve();
+  REQUIRE(num_conv == nev);
+  ComplexVector x(n);
+  x.UseDevice(true);
+  for (int i = 0; i < num_conv; i++)
+  {
+    // Converged eigenvalues are sorted by increasing imaginary part.
+    const double ki = (i + 2.0) * (i + 2.0);
+    const std::complex<double> l = eigen.GetEigenvalue(i);
+    CHECK_THAT(l.real(), WithinAbs(-0.5 * damping, 1.0e-6));
+    CHECK_THAT(l.imag(), WithinAbs(std::sqrt(ki - 0.25 * damping * damping), 1.0e-6));
+    CHECK(eigen.GetError(i, EigenvalueSolver::ErrorType::BACKWARD) < 1.0e-8);
+
+    // The eigenvector is the unit vector for the i + 1-th degree of freedom (up to a
+    // phase).
+    eigen.GetEigenvector(i, x);
+    const double xi = std::abs(std::complex<double>(x.Real()(i + 1), x.Imag()(i + 1)));
+    CHECK_THAT(xi, WithinAbs(1.0, 1.0e-6));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Beyn Contour Eigenvalue Solver", "[Beyn][Serial]")
+{
+  MPI_Comm comm = Mpi::World();
+  SECTION("Generalized eigenvalue problem")
+  {
+    CheckBeyn(comm, 0.0);
+  }
+  SECTION("Quadratic eigenvalue problem")
+  {
+    CheckBeyn(comm, 0.2);
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,75 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+#include <memory>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+#include "utils/geodata.hpp"
+
+namespace palace
+{
+
+using namespace Catch::Matchers;
+
+TEST_CASE("Dorfler Mesh Coarsening", "[Coarsening][Serial][Parallel]")
+{
+  // A 2 x 2 x 2 mesh is refined once, and the children of the parents with x < 0.5 carry a
+  // much larger error than those with x > 0.5. The four low-error parents make up far less
+  // than the fraction θ of the total error and are derefined. Coarsening any high-error
+  // parent would exceed θ, and the error of each of these parents is exactly at the
+  // threshold, so they are kept. The squared estimates of the children are summed on the
+  // coarsened parents.
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 2;
+  constexpr double e_hi = 1.0, e_lo = 1.0e-2, fraction = 0.1;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  smesh.EnsureNCMesh();
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  mfem::ParMesh mesh(comm, smesh);
+  mesh.UniformRefinement();
+  REQUIRE(mesh.Nonconforming());
+  REQUIRE(mesh.GetGlobalNE() == 8 * n * n * n);
+
+  auto LowError = [&mesh](int i)
+  {
+    mfem::Vector c;
+    mesh.GetElementCenter(i, c);
+    return (c(0) > 0.5);
+  };
+  Vector e(mesh.GetNE());
+  double e2_sum = 0.0;
+  for (int i = 0; i < mesh.GetNE(); i++)
+  {
+    e[i] = LowError(i) ? e_lo : e_hi;
+    e2_sum += e[i] * e[i];
+  }
+  Mpi::GlobalSum(1, &e2_sum, comm);
+
+  const int n_derefined = mesh::CoarsenMesh(mesh, e, fraction, 1);
+  CHECK(n_derefined == 4 * 7);
+  CHECK(mesh.GetGlobalNE() == 4 * 8 + 4);
+  REQUIRE(e.Size() == mesh.GetNE());
+
+  // The refined half keeps its estimates, and the estimates of the coarsened parents are
+  // the square root of the sum of the squared estimates of the eight children.
+  double e2_sum_coarse = 0.0;
+  for (int i = 0; i < mesh.GetNE(); i++)
+  {
+    const bool coarse = (mesh.GetElementVolume(i) > 0.5 / (n * n * n));
+    CHECK(coarse == LowError(i));
+    CHECK_THAT(e[i], WithinRel(coarse ? std::sqrt(8.0) * e_lo : e_hi, 1.0e-12));
+    e2_sum_coarse += e[i] * e[i];
+  }
+  Mpi::GlobalSum(1, &e2_sum_coarse, comm);
+  CHECK_THAT(e2_sum_coarse, WithinRel(e2_sum, 1.0e-12));
+
+  // A second coarsening finds no opportunities with error below the threshold.
+  CHECK(mesh::CoarsenMesh(mesh, e, fraction, 1) == 0);
+}
+
+}  // namespace palace
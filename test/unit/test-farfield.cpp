@@ -0,0 +1,120 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "fem/gridfunction.hpp"
+#include "fem/integrator.hpp"
+#include "fem/mesh.hpp"
+#include "linalg/vector.hpp"
+#include "models/spaceoperator.hpp"
+#include "models/strattonchu.hpp"
+#include "models/surfacepostoperator.hpp"
+#include "utils/communication.hpp"
+#include "utils/iodata.hpp"
+
+namespace palace
+{
+
+TEST_CASE("Far-Field Stratton-Chu Kernel", "[FarField][Serial][Parallel]")
+{
+  // The far-field kernel evaluated from the precomputed surface currents agrees with the
+  // reference integration of the Stratton-Chu integrand one boundary element at a time,
+  // for random complex fields and a complex frequency. The number of directions is not a
+  // multiple of the direction block size of the kernel.
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 3;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  auto pmesh = std::make_unique<mfem::ParMesh>(comm, smesh);
+
+  IoData iodata(Units(1.0, 1.0));
+  iodata.problem.type = ProblemType::DRIVEN;
+  iodata.model.L0 = 1.0;
+  iodata.domains.attributes = {1};
+  auto &material = iodata.domains.materials.emplace_back();
+  material.attributes = {1};
+  auto &farfield = iodata.boundaries.postpro.farfield;
+  farfield.attributes = {1, 2, 3, 4, 5, 6};
+  constexpr int n_theta = 5, n_phi = 7;
+  for (int i = 0; i < n_theta; i++)
+  {
+    for (int j = 0; j < n_phi; j++)
+    {
+      farfield.thetaphis.emplace_back(M_PI * (i + 0.5) / n_theta, 2.0 * M_PI * j / n_phi);
+    }
+  }
+  iodata.solver.order = 2;
+  iodata.NondimensionalizeInputs(*pmesh);
+  std::vector<std::unique_ptr<Mesh>> mesh;
+  mesh.push_back(std::make_unique<Mesh>(std::move(pmesh)));
+  SpaceOperator space_op(iodata, mesh);
+  SurfacePostOperator surf_post_op(iodata, space_op.GetMaterialOp(), space_op.GetH1Space(),
+                                   space_op.GetNDSpace());
+
+  GridFunction E(space_op.GetNDSpace(), true), B(space_op.GetRTSpace(), true);
+  {
+    Vector e(space_op.GetNDSpace().GetTrueVSize()), b(space_op.GetRTSpace().GetTrueVSize());
+    e.UseDevice(true);
+    b.UseDevice(true);
+    linalg::SetRandom(comm, e, 1);
+    E.Real().SetFromTrueDofs(e);
+    linalg::SetRandom(comm, e, 2);
+    E.Imag().SetFromTrueDofs(e);
+    linalg::SetRandom(comm, b, 3);
+    B.Real().SetFromTrueDofs(b);
+    linalg::SetRandom(comm, b, 4);
+    B.Imag().SetFromTrueDofs(b);
+  }
+  constexpr double omega_re = 2.0, omega_im = 0.1;
+  const auto rE =
+      surf_post_op.GetFarFieldrE(farfield.thetaphis, E, B, omega_re, omega_im);
+  REQUIRE(rE.size() == farfield.thetaphis.size());
+
+  // Reference result.
+  std::vector<std::array<double, 3>> r_naughts;
+  for (const auto &[theta, phi] : farfield.thetaphis)
+  {
+    r_naughts.push_back({std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi),
+                         std::cos(theta)});
+  }
+  std::vector<std::array<double, 3>> integrals_r(r_naughts.size()),
+      integrals_i(r_naughts.size());
+  auto &pmesh_ref = space_op.GetNDSpace().GetParMesh();
+  for (int i = 0; i < pmesh_ref.GetNBE(); i++)
+  {
+    auto &T = *pmesh_ref.GetBdrElementTransformation(i);
+    const auto &ir = mfem::IntRules.Get(pmesh_ref.GetBdrElementGeometry(i),
+                                        fem::DefaultIntegrationOrder::Get(T));
+    AddStrattonChuIntegrandAtElement(E, B, space_op.GetMaterialOp(), omega_re, omega_im,
+                                     r_naughts, T, ir, integrals_r, integrals_i);
+  }
+  Mpi::GlobalSum(3 * integrals_r.size(), integrals_r.data()->data(), comm);
+  Mpi::GlobalSum(3 * integrals_i.size(), integrals_i.data()->data(), comm);
+
+  double max_norm = 0.0, max_diff = 0.0;
+  StaticVector<3> tmp_r, tmp_i;
+  for (std::size_t k = 0; k < r_naughts.size(); k++)
+  {
+    linalg::Cross3(r_naughts[k], integrals_r[k], tmp_r);
+    linalg::Cross3(r_naughts[k], integrals_i[k], tmp_i);
+    for (int d = 0; d < 3; d++)
+    {
+      const std::complex<double> ref(tmp_r[d], tmp_i[d]);
+      max_norm = std::max(max_norm, std::abs(ref));
+      max_diff = std::max(max_diff, std::abs(rE[k][d] - ref));
+    }
+  }
+  REQUIRE(max_norm > 0.0);
+  CHECK(max_diff <= 1.0e-12 * max_norm);
+}
+
+}  // namespace palace
@@ -0,0 +1,127 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "fem/bilinearform.hpp"
+#include "fem/fespace.hpp"
+#include "fem/integrator.hpp"
+#include "fem/mesh.hpp"
+#include "fem/multigrid.hpp"
+#include "linalg/gmg.hpp"
+#include "linalg/iterative.hpp"
+#include "linalg/rap.hpp"
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+#include "utils/iodata.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+// Complex-symmetric operator A = (K + M) + i M for the H¹ stiffness and mass matrices on
+// each level of a p-multigrid hierarchy, with homogeneous Dirichlet conditions on the
+// whole boundary.
+std::unique_ptr<ComplexMultigridOperator>
+GetSystemMatrix(const FiniteElementSpaceHierarchy &fespaces,
+                const std::vector<mfem::Array<int>> &dbc_tdof_lists)
+{
+  constexpr bool skip_zeros = false;
+  BilinearForm ar(fespaces.GetFinestFESpace()), ai(fespaces.GetFinestFESpace());
+  ar.AddDomainIntegrator<DiffusionIntegrator>();
+  ar.AddDomainIntegrator<MassIntegrator>();
+  ai.AddDomainIntegrator<MassIntegrator>();
+  auto ar_vec = ar.Assemble(fespaces, skip_zeros);
+  auto ai_vec = ai.Assemble(fespaces, skip_zeros);
+  auto A = std::make_unique<ComplexMultigridOperator>(fespaces.GetNumLevels());
+  for (std::size_t l = 0; l < fespaces.GetNumLevels(); l++)
+  {
+    auto A_l = std::make_unique<ComplexParOperator>(
+        std::move(ar_vec[l]), std::move(ai_vec[l]), fespaces.GetFESpaceAtLevel(l));
+    A_l->SetEssentialTrueDofs(dbc_tdof_lists[l], Operator::DiagonalPolicy::DIAG_ONE);
+    A->AddOperator(std::move(A_l));
+  }
+  return A;
+}
+
+// Solves the system with FGMRES preconditioned by a single multigrid cycle of the given
+// type, and returns the number of iterations.
+int SolveGmg(MPI_Comm comm, const FiniteElementSpaceHierarchy &fespaces,
+             const ComplexMultigridOperator &A, MultigridCycle cycle_type,
+             const ComplexVector &b, ComplexVector &x)
+{
+  // The coarse space is small, so an unpreconditioned GMRES solve to a tight tolerance
+  // stands in for a direct solver.
+  auto coarse = std::make_unique<GmresSolver<ComplexOperator>>(comm, 0);
+  coarse->SetRelTol(1.0e-12);
+  coarse->SetMaxIter(1000);
+  coarse->SetRestartDim(100);
+  GeometricMultigridSolver<ComplexOperator> gmg(comm, std::move(coarse),
+                                                fespaces.GetProlongationOperators(),
+                                                nullptr, 1, cycle_type, 1, 2, 1.0, 0.0,
+                                                true);
+  gmg.SetOperator(A);
+
+  FgmresSolver<ComplexOperator> fgmres(comm, 0);
+  fgmres.SetRelTol(1.0e-8);
+  fgmres.SetMaxIter(200);
+  fgmres.SetRestartDim(50);
+  fgmres.SetOperator(A);
+  fgmres.SetPreconditioner(gmg);
+  x = 0.0;
+  fgmres.Mult(b, x);
+  REQUIRE(fgmres.GetConverged());
+  return fgmres.GetNumIterations();
+}
+
+}  // namespace
+
+TEST_CASE("Complex Geometric Multigrid K-Cycle", "[GeometricMultigrid][Serial][Parallel]")
+{
+  // A four-level p-multigrid hierarchy (p = 1, 2, 3, 4), so that the Krylov acceleration
+  // of the K-cycle is active on the two intermediate levels.
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 3, order = 4, dim = 3, mg_max_levels = 4;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  std::vector<std::unique_ptr<Mesh>> mesh;
+  mesh.push_back(std::make_unique<Mesh>(std::make_unique<mfem::ParMesh>(comm, smesh)));
+  auto fecs = fem::ConstructFECollections<mfem::H1_FECollection>(
+      order, dim, mg_max_levels, MultigridCoarsening::LINEAR, false);
+  mfem::Array<int> dbc_attr({1, 2, 3, 4, 5, 6});
+  std::vector<mfem::Array<int>> dbc_tdof_lists;
+  auto fespaces = fem::ConstructFiniteElementSpaceHierarchy<mfem::H1_FECollection>(
+      mg_max_levels, mesh, fecs, &dbc_attr, &dbc_tdof_lists);
+  REQUIRE(static_cast<int>(fespaces.GetNumLevels()) == mg_max_levels);
+  auto A = GetSystemMatrix(fespaces, dbc_tdof_lists);
+
+  const int size = A->Height();
+  ComplexVector b(size), x_v(size), x_k(size), r(size);
+  b.UseDevice(true);
+  x_v.UseDevice(true);
+  x_k.UseDevice(true);
+  r.UseDevice(true);
+  linalg::SetRandom(comm, b, 1);
+  linalg::SetSubVector(b, dbc_tdof_lists.back(), 0.0);
+  const int it_v = SolveGmg(comm, fespaces, *A, MultigridCycle::V_CYCLE, b, x_v);
+  const int it_k = SolveGmg(comm, fespaces, *A, MultigridCycle::K_CYCLE, b, x_k);
+
+  // Check the true residual and agreement of the solutions.
+  const double b_norm = linalg::Norml2(comm, b);
+  A->Mult(x_k, r);
+  r -= b;
+  CHECK(linalg::Norml2(comm, r) <= 1.0e-6 * b_norm);
+  r = x_k;
+  r -= x_v;
+  CHECK(linalg::Norml2(comm, r) <= 1.0e-5 * linalg::Norml2(comm, x_v));
+
+  // The Krylov-accelerated coarse corrections do not increase the outer iteration count.
+  CHECK(it_k <= it_v);
+}
+
+}  // namespace palace
@@ -0,0 +1,192 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "linalg/iterative.hpp"
+#include "linalg/solver.hpp"
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+// Shifted 1D Laplacian on each process, with a varying diagonal and an optional
+// (nonsymmetric) convection term. The global operator is block diagonal over the processes,
+// which is enough for testing the Krylov solvers.
+std::unique_ptr<mfem::SparseMatrix> TestMatrix(int n, double shift, double conv = 0.0)
+{
+  auto A = std::make_unique<mfem::SparseMatrix>(n, n);
+  for (int i = 0; i < n; i++)
+  {
+    A->Add(i, i, 2.0 + shift * (1.0 + i % 7));
+    if (i > 0)
+    {
+      A->Add(i, i - 1, -1.0 - conv);
+    }
+    if (i < n - 1)
+    {
+      A->Add(i, i + 1, -1.0 + conv);
+    }
+  }
+  A->Finalize();
+  return A;
+}
+
+// Diagonal (Jacobi) preconditioner.
+class JacobiSolver : public Solver<Operator>
+{
+private:
+  Vector dinv;
+
+public:
+  JacobiSolver(const mfem::SparseMatrix &A) : dinv(A.Height())
+  {
+    A.GetDiag(dinv);
+    for (int i = 0; i < dinv.Size(); i++)
+    {
+      dinv(i) = 1.0 / dinv(i);
+    }
+  }
+
+  void SetOperator(const Operator &op) override {}
+
+  void Mult(const Vector &x, Vector &y) const override
+  {
+    y.SetSize(x.Size());
+    for (int i = 0; i < x.Size(); i++)
+    {
+      y(i) = dinv(i) * x(i);
+    }
+  }
+};
+
+void CheckBlockCg(MPI_Comm comm, const std::vector<Vector> &b, bool initial_guess)
+{
+  const int n = static_cast<int>(b.size());
+  auto A = TestMatrix(b[0].Size(), 1.0e-2);
+  JacobiSolver B(*A);
+  CgSolver<Operator> cg(comm, 0);
+  cg.SetRelTol(1.0e-12);
+  cg.SetMaxIter(1000);
+  cg.SetOperator(*A);
+  cg.SetPreconditioner(B);
+  cg.SetInitialGuess(initial_guess);
+
+  // Reference solutions from independent single-vector solves.
+  std::vector<Vector> x_ref(n), x(n);
+  for (int j = 0; j < n; j++)
+  {
+    x_ref[j].SetSize(b[j].Size());
+    x[j].SetSize(b[j].Size());
+    linalg::SetRandom(comm, x_ref[j], 100 + j);
+    x[j] = x_ref[j];
+    cg.Mult(b[j], x_ref[j]);
+    REQUIRE(cg.GetConverged());
+  }
+
+  // Block solve.
+  mfem::Array<const Vector *> b_(n);
+  mfem::Array<Vector *> x_(n);
+  for (int j = 0; j < n; j++)
+  {
+    b_[j] = &b[j];
+    x_[j] = &x[j];
+  }
+  cg.BlockMult(b_, x_);
+  REQUIRE(cg.GetConverged());
+
+  Vector r(b[0].Size());
+  for (int j = 0; j < n; j++)
+  {
+    // Compare to the reference solution, and check the true residual.
+    r = x[j];
+    r -= x_ref[j];
+    const double x_norm = linalg::Norml2(comm, x_ref[j]);
+    CHECK(linalg::Norml2(comm, r) <= 1.0e-8 * x_norm);
+    A->Mult(x[j], r);
+    r -= b[j];
+    CHECK(linalg::Norml2(comm, r) <= 1.0e-8 * linalg::Norml2(comm, b[j]));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Block PCG", "[BlockCG][Serial][Parallel]")
+{
+  MPI_Comm comm = Mpi::World();
+  constexpr int size = 200, n = 4;
+  std::vector<Vector> b(n);
+  for (int j = 0; j < n; j++)
+  {
+    b[j].SetSize(size);
+    linalg::SetRandom(comm, b[j], j + 1);
+  }
+  SECTION("Independent right-hand sides")
+  {
+    CheckBlockCg(comm, b, false);
+    CheckBlockCg(comm, b, true);
+  }
+  SECTION("Linearly dependent right-hand sides")
+  {
+    // Duplicated and dependent columns make the block rank deficient from the start, which
+    // must be handled by dropping search directions.
+    b[2] = b[0];
+    b[3] = b[0];
+    b[3] += b[1];
+    CheckBlockCg(comm, b, false);
+  }
+}
+
+TEST_CASE("GCRO-DR Recycling", "[GCRO-DR][Serial][Parallel]")
+{
+  // Solve a sequence of slowly varying nonsymmetric systems with restarted GMRES and with
+  // GCRO-DR, which recycles a subspace across restarts and solves.
+  MPI_Comm comm = Mpi::World();
+  constexpr int size = 400, n_solve = 5;
+  GmresSolver<Operator> gmres(comm, 0);
+  GcroDrSolver<Operator> gcrodr(comm, 0);
+  for (auto *ksp : {static_cast<GmresSolver<Operator> *>(&gmres),
+                    static_cast<GmresSolver<Operator> *>(&gcrodr)})
+  {
+    ksp->SetRelTol(1.0e-10);
+    ksp->SetMaxIter(5000);
+    ksp->SetRestartDim(20);
+  }
+  gcrodr.SetRecycleDim(8);
+
+  int it_gmres = 0, it_gcrodr = 0;
+  Vector b(size), x_ref(size), x(size), r(size);
+  for (int k = 0; k < n_solve; k++)
+  {
+    auto A = TestMatrix(size, 1.0e-2 * (1.0 + 0.1 * k), 0.2);
+    linalg::SetRandom(comm, b, k + 1);
+    gmres.SetOperator(*A);
+    gcrodr.SetOperator(*A);
+    gmres.Mult(b, x_ref);
+    REQUIRE(gmres.GetConverged());
+    gcrodr.Mult(b, x);
+    REQUIRE(gcrodr.GetConverged());
+    it_gmres += gmres.GetNumIterations();
+    it_gcrodr += gcrodr.GetNumIterations();
+
+    // Both solutions satisfy the system to the requested tolerance, and agree.
+    A->Mult(x, r);
+    r -= b;
+    CHECK(linalg::Norml2(comm, r) <= 1.0e-8 * linalg::Norml2(comm, b));
+    r = x;
+    r -= x_ref;
+    CHECK(linalg::Norml2(comm, r) <= 1.0e-6 * linalg::Norml2(comm, x_ref));
+  }
+
+  // Recycling the subspace of small harmonic Ritz values does not increase the total
+  // iteration count over the sequence.
+  CHECK(it_gcrodr <= it_gmres);
+}
+
+}  // namespace palace
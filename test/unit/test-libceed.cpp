@@ -13,6 +13,8 @@
 #include "fem/integrator.hpp"
 #include "fem/mesh.hpp"
 #include "linalg/hypre.hpp"
+#include "linalg/rap.hpp"
+#include "linalg/vector.hpp"
 #include "models/materialoperator.hpp"
 #include "utils/communication.hpp"
 
@@ -1196,6 +1198,128 @@ void RunCeedInterpolatorTests(MPI_Comm comm, const std::string &input, int ref_l
   }
 }
 
+void TestCeedOperatorCSR(hypre::HypreCSRMatrix &mat)
+{
+  // The duplicate COO entries are summed, so the column indices in each row of the
+  // assembled matrix are strictly increasing.
+  hypre_CSRMatrixMigrate(mat, HYPRE_MEMORY_HOST);
+  const auto *I = mat.GetI();
+  const auto *J = mat.GetJ();
+  REQUIRE(I[0] == 0);
+  REQUIRE(I[mat.Height()] == mat.NNZ());
+  bool sorted = true;
+  for (int i = 0; i < mat.Height(); i++)
+  {
+    for (int k = I[i] + 1; k < I[i + 1]; k++)
+    {
+      sorted = sorted && (J[k - 1] < J[k]);
+    }
+  }
+  REQUIRE(sorted);
+}
+
+void RunCeedFullAssemblyTests(MPI_Comm comm, const std::string &input, bool amr, int order)
+{
+  // Load the mesh.
+  auto mesh = Initialize(comm, input, 0, amr);
+  const int dim = mesh.Dimension();
+
+  // Match MFEM's default integration orders.
+  fem::DefaultIntegrationOrder::p_trial = order;
+  fem::DefaultIntegrationOrder::q_order_jac = true;
+  fem::DefaultIntegrationOrder::q_order_extra_pk = 0;
+  fem::DefaultIntegrationOrder::q_order_extra_qk = 0;
+
+  // The domain and boundary integrators each contribute COO entries for the nonzeros at the
+  // boundary dofs, in addition to the entries from the elements sharing a dof.
+  mfem::H1_FECollection h1_fec(order, dim);
+  FiniteElementSpace h1_fespace(mesh, &h1_fec);
+  BilinearForm a_test(h1_fespace);
+  mfem::BilinearForm a_ref(&h1_fespace.Get());
+  a_test.AddDomainIntegrator<MassIntegrator>();
+  a_test.AddBoundaryIntegrator<MassIntegrator>();
+  a_ref.AddDomainIntegrator(new mfem::MassIntegrator());
+  a_ref.AddBoundaryIntegrator(new mfem::MassIntegrator());
+  a_ref.Assemble();
+  a_ref.Finalize();
+
+  auto op_test = a_test.PartialAssemble();
+  auto mat_test = BilinearForm::FullAssemble(*op_test, false);
+  auto mat_test_skip = BilinearForm::FullAssemble(*op_test, true);
+  TestCeedOperatorCSR(*mat_test);
+  TestCeedOperatorCSR(*mat_test_skip);
+  REQUIRE(mat_test_skip->NNZ() <= mat_test->NNZ());
+  TestCeedOperatorFullAssemble(*mat_test, a_ref.SpMat());
+  TestCeedOperatorFullAssemble(*mat_test_skip, a_ref.SpMat());
+}
+
+template <typename T1, typename T2, typename T3, typename T4>
+void TestCeedLORAssembly(MPI_Comm comm, FiniteElementSpace &fespace)
+{
+  // The LOR matrix in the local dofs of the high-order space, parallel assembled with the
+  // prolongation of the high-order space, must agree with MFEM's parallel assembly on its
+  // LOR space (which has the same true dofs).
+  BilinearForm a_test(fespace);
+  a_test.AddDomainIntegrator<T1>();
+  a_test.AddDomainIntegrator<T2>();
+  ParOperator A_test(a_test.FullAssembleLOR(fespace, false), fespace);
+
+  mfem::ParLORDiscretization lor(fespace.Get());
+  mfem::ParBilinearForm a_ref(&lor.GetParFESpace());
+  a_ref.AddDomainIntegrator(new T3());
+  a_ref.AddDomainIntegrator(new T4());
+  a_ref.Assemble();
+  a_ref.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> A_ref(a_ref.ParallelAssemble());
+  REQUIRE(A_ref->Height() == A_test.Height());
+
+  Vector x(A_test.Width()), y_ref(A_test.Height()), y_test(A_test.Height());
+  x.UseDevice(true);
+  y_ref.UseDevice(true);
+  y_test.UseDevice(true);
+  linalg::SetRandom(comm, x, 1);
+  A_ref->Mult(x, y_ref);
+  A_test.Mult(x, y_test);
+  const double ref_norm = linalg::Norml2(comm, y_ref);
+  REQUIRE(ref_norm > 0.0);
+  y_test -= y_ref;
+  REQUIRE(linalg::Norml2(comm, y_test) <= 1.0e-12 * ref_norm);
+}
+
+void RunCeedLORAssemblyTests(MPI_Comm comm, int order)
+{
+  // Cartesian hexahedral mesh, for which the default quadrature of the first-order elements
+  // on the LOR mesh is exact for MFEM and libCEED alike.
+  constexpr int n = 2, dim = 3;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  Mesh mesh(std::make_unique<mfem::ParMesh>(comm, smesh));
+  fem::DefaultIntegrationOrder::p_trial = 1;
+  fem::DefaultIntegrationOrder::q_order_jac = true;
+  fem::DefaultIntegrationOrder::q_order_extra_pk = 0;
+  fem::DefaultIntegrationOrder::q_order_extra_qk = 0;
+  INFO("Order: " << order);
+
+  SECTION("H1 LOR Assembly")
+  {
+    mfem::H1_FECollection h1_fec(order, dim);
+    FiniteElementSpace h1_fespace(mesh, &h1_fec);
+    TestCeedLORAssembly<DiffusionIntegrator, MassIntegrator, mfem::DiffusionIntegrator,
+                        mfem::MassIntegrator>(comm, h1_fespace);
+  }
+  SECTION("H(curl) LOR Assembly")
+  {
+    // Signed permutation between the LOR and high-order dofs.
+    mfem::ND_FECollection nd_fec(order, dim, mfem::BasisType::GaussLobatto,
+                                 mfem::BasisType::IntegratedGLL);
+    FiniteElementSpace nd_fespace(mesh, &nd_fec);
+    TestCeedLORAssembly<CurlCurlIntegrator, VectorFEMassIntegrator,
+                        mfem::CurlCurlIntegrator, mfem::VectorFEMassIntegrator>(comm,
+                                                                                nd_fespace);
+  }
+}
+
 void RunCeedBenchmarks(MPI_Comm comm, const std::string &input, int ref_levels, bool amr,
                        int order)
 {
@@ -1450,6 +1574,21 @@ TEST_CASE("3D libCEED Interpolators", "[libCEED][Interpolator][Serial][Parallel]
                            amr, order);
 }
 
+TEST_CASE("3D libCEED Full Assembly", "[libCEED][Serial][Parallel][GPU]")
+{
+  auto mesh = GENERATE("fichera-hex.mesh", "fichera-tet.mesh");
+  auto amr = GENERATE(false, true);
+  auto order = GENERATE(1, 2);
+  RunCeedFullAssemblyTests(MPI_COMM_WORLD, std::string(PALACE_TEST_MESH_DIR "/") + mesh,
+                           amr, order);
+}
+
+TEST_CASE("3D libCEED LOR Assembly", "[libCEED][LOR][Serial][Parallel]")
+{
+  auto order = GENERATE(2, 3);
+  RunCeedLORAssemblyTests(MPI_COMM_WORLD, order);
+}
+
 TEST_CASE("3D libCEED Benchmarks", "[libCEED][Benchmark][Serial][Parallel][GPU]")
 {
   auto mesh = GENERATE("fichera-hex.mesh", "fichera-tet.mesh");
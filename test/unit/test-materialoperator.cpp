@@ -0,0 +1,223 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "models/materialoperator.hpp"
+
+namespace palace
+{
+
+using namespace Catch::Matchers;
+
+namespace
+{
+
+// Returns the 3x3 material property for the given (1-based) attribute, expanding scalar
+// (isotropic) storage to a multiple of the identity.
+mfem::DenseMatrix GetProperty(const MaterialPropertyCoefficient &coeff, int attr)
+{
+  const auto &mat_coeff = coeff.GetMaterialProperties();
+  const int k = coeff.GetAttributeToMaterial()[attr - 1];
+  REQUIRE(k >= 0);
+  mfem::DenseMatrix T(3);
+  T = 0.0;
+  if (mat_coeff.SizeI() == 1)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      T(i, i) = mat_coeff(0, 0, k);
+    }
+  }
+  else
+  {
+    REQUIRE((mat_coeff.SizeI() == 3 && mat_coeff.SizeJ() == 3));
+    T = mat_coeff(k);
+  }
+  return T;
+}
+
+void CheckProperty(const MaterialPropertyCoefficient &coeff, int attr,
+                   const mfem::DenseMatrix &T_ref)
+{
+  const auto T = GetProperty(coeff, attr);
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      CHECK_THAT(T(i, j), WithinAbs(T_ref(i, j), 1.0e-12));
+    }
+  }
+}
+
+mfem::DenseTensor IsotropicTensor(const std::vector<double> &c)
+{
+  mfem::DenseTensor mat_coeff(3, 3, static_cast<int>(c.size()));
+  mat_coeff = 0.0;
+  for (int k = 0; k < mat_coeff.SizeK(); k++)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      mat_coeff(i, i, k) = c[k];
+    }
+  }
+  return mat_coeff;
+}
+
+mfem::DenseMatrix AnisotropicMatrix()
+{
+  mfem::DenseMatrix A(3);
+  A = 0.0;
+  A(0, 0) = 2.0;
+  A(1, 1) = 3.0;
+  A(2, 2) = 4.0;
+  A(0, 1) = A(1, 0) = 0.5;
+  return A;
+}
+
+}  // namespace
+
+TEST_CASE("MaterialPropertyCoefficient Isotropic Storage", "[MaterialOperator][Serial]")
+{
+  // Attributes 1 and 3 use material 0, attribute 2 uses material 1.
+  mfem::Array<int> attr_mat({0, 1, 0});
+
+  SECTION("Isotropic materials are stored as scalars")
+  {
+    MaterialPropertyCoefficient coeff(attr_mat, IsotropicTensor({1.5, 2.5}), 2.0);
+    CHECK(coeff.GetMaterialProperties().SizeI() == 1);
+    CHECK(coeff.GetMaterialProperties().SizeJ() == 1);
+    CHECK_THAT(coeff.GetMaterialProperties()(0, 0, 0), WithinAbs(3.0, 1.0e-12));
+    CHECK_THAT(coeff.GetMaterialProperties()(0, 0, 1), WithinAbs(5.0, 1.0e-12));
+  }
+
+  SECTION("Isotropy is detected to a relative tolerance")
+  {
+    // Perturbations from rounding relative to the material scale still give scalar storage,
+    // while larger off-diagonal entries keep the matrix-valued storage.
+    auto mat_coeff = IsotropicTensor({1.0e6, 2.0});
+    mat_coeff(0, 1, 0) = mat_coeff(1, 0, 0) = 1.0e-6;
+    mat_coeff(2, 2, 0) *= 1.0 + 1.0e-12;
+    MaterialPropertyCoefficient coeff(attr_mat, mat_coeff);
+    CHECK(coeff.GetMaterialProperties().SizeI() == 1);
+    CHECK_THAT(coeff.GetMaterialProperties()(0, 0, 0), WithinRel(1.0e6, 1.0e-11));
+    CHECK_THAT(coeff.GetMaterialProperties()(0, 0, 1), WithinRel(2.0, 1.0e-12));
+
+    mat_coeff(0, 1, 0) = mat_coeff(1, 0, 0) = 1.0e-1;
+    MaterialPropertyCoefficient coeff_aniso(attr_mat, mat_coeff);
+    CHECK(coeff_aniso.GetMaterialProperties().SizeI() == 3);
+  }
+
+  SECTION("Adding an anisotropic tensor promotes to matrix-valued")
+  {
+    // Empty coefficient initialized from an isotropic tensor, then updated with an
+    // anisotropic one for the same materials.
+    MaterialPropertyCoefficient coeff(3);
+    coeff.AddCoefficient(attr_mat, IsotropicTensor({1.0, 2.0}));
+    REQUIRE(coeff.GetMaterialProperties().SizeI() == 1);
+    mfem::DenseTensor aniso(3, 3, 2);
+    aniso(0) = AnisotropicMatrix();
+    aniso(1) = 0.0;
+    coeff.AddCoefficient(attr_mat, aniso, 0.5);
+    CHECK(coeff.GetMaterialProperties().SizeI() == 3);
+
+    mfem::DenseMatrix T_ref(AnisotropicMatrix());
+    T_ref *= 0.5;
+    for (int i = 0; i < 3; i++)
+    {
+      T_ref(i, i) += 1.0;
+    }
+    CheckProperty(coeff, 1, T_ref);
+    CheckProperty(coeff, 3, T_ref);
+    T_ref = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+      T_ref(i, i) = 2.0;
+    }
+    CheckProperty(coeff, 2, T_ref);
+  }
+
+  SECTION("Adding an anisotropic property for new attributes promotes to matrix-valued")
+  {
+    // Scalar storage for attributes 1 and 2, then an anisotropic material for attribute 3
+    // with a different attribute to material map.
+    MaterialPropertyCoefficient coeff(3);
+    mfem::Array<int> attr_mat_12({0, 0, -1});
+    coeff.AddCoefficient(attr_mat_12, IsotropicTensor({4.0}));
+    REQUIRE(coeff.GetMaterialProperties().SizeI() == 1);
+    mfem::Array<int> attr_mat_3({-1, -1, 0});
+    mfem::DenseTensor aniso(3, 3, 1);
+    aniso(0) = AnisotropicMatrix();
+    coeff.AddCoefficient(attr_mat_3, aniso);
+    CHECK(coeff.GetMaterialProperties().SizeI() == 3);
+    CHECK(coeff.GetMaterialProperties().SizeK() == 2);
+
+    mfem::DenseMatrix T_ref(3);
+    T_ref = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+      T_ref(i, i) = 4.0;
+    }
+    CheckProperty(coeff, 1, T_ref);
+    CheckProperty(coeff, 2, T_ref);
+    CheckProperty(coeff, 3, AnisotropicMatrix());
+  }
+
+  SECTION("Isotropic matrix property reuses an existing scalar material")
+  {
+    MaterialPropertyCoefficient coeff(3);
+    mfem::Array<int> attr_mat_12({0, 0, -1});
+    coeff.AddCoefficient(attr_mat_12, IsotropicTensor({4.0}));
+    mfem::DenseMatrix T_ref(3);
+    T_ref = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+      T_ref(i, i) = 4.0;
+    }
+    coeff.AddMaterialProperty(3, T_ref);
+    CHECK(coeff.GetMaterialProperties().SizeK() == 1);
+    CHECK(coeff.GetAttributeToMaterial()[2] == coeff.GetAttributeToMaterial()[0]);
+    for (int attr = 1; attr <= 3; attr++)
+    {
+      CheckProperty(coeff, attr, T_ref);
+    }
+  }
+}
+
+TEST_CASE("MaterialPropertyCoefficient Normal Projection", "[MaterialOperator][Serial]")
+{
+  // The normal is not unit length, so that the scalar branch is checked against the
+  // matrix-valued n^T C n for C = c I.
+  mfem::Array<int> attr_mat({0, 1});
+  mfem::Vector normal({1.0, 2.0, 2.0});
+
+  SECTION("Scalar-valued")
+  {
+    MaterialPropertyCoefficient coeff(attr_mat, IsotropicTensor({1.5, 2.5}));
+    REQUIRE(coeff.GetMaterialProperties().SizeI() == 1);
+    coeff.NormalProjectedCoefficient(normal);
+    const auto &mat_coeff = coeff.GetMaterialProperties();
+    CHECK(mat_coeff.SizeI() == 1);
+    CHECK_THAT(mat_coeff(0, 0, 0), WithinAbs(9.0 * 1.5, 1.0e-12));
+    CHECK_THAT(mat_coeff(0, 0, 1), WithinAbs(9.0 * 2.5, 1.0e-12));
+  }
+
+  SECTION("Matrix-valued")
+  {
+    mfem::DenseTensor aniso(3, 3, 2);
+    aniso(0) = AnisotropicMatrix();
+    aniso(1) = AnisotropicMatrix();
+    aniso(1) *= 2.0;
+    MaterialPropertyCoefficient coeff(attr_mat, aniso);
+    REQUIRE(coeff.GetMaterialProperties().SizeI() == 3);
+    coeff.NormalProjectedCoefficient(normal);
+    const auto &mat_coeff = coeff.GetMaterialProperties();
+    CHECK(mat_coeff.SizeI() == 1);
+    const double nAn = 32.0;  // n^T A n for n = (1, 2, 2)
+    CHECK_THAT(mat_coeff(0, 0, 0), WithinAbs(nAn, 1.0e-12));
+    CHECK_THAT(mat_coeff(0, 0, 1), WithinAbs(2.0 * nAn, 1.0e-12));
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,187 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include "fem/bilinearform.hpp"
+#include "fem/fespace.hpp"
+#include "fem/integrator.hpp"
+#include "fem/mesh.hpp"
+#include "linalg/rap.hpp"
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+// Checks the multiple-vector application of the operator (and its transpose) against the
+// application of the single-vector methods one column at a time, for a block of n
+// columns.
+void CheckArrayMult(MPI_Comm comm, const ParOperator &op, int n)
+{
+  std::vector<Vector> x(n), y(n), y_ref(n), xt(n), yt(n), yt_ref(n);
+  mfem::Array<const Vector *> X(n), XT(n);
+  mfem::Array<Vector *> Y(n), YT(n);
+  for (int j = 0; j < n; j++)
+  {
+    x[j].SetSize(op.Width());
+    y[j].SetSize(op.Height());
+    y_ref[j].SetSize(op.Height());
+    xt[j].SetSize(op.Height());
+    yt[j].SetSize(op.Width());
+    yt_ref[j].SetSize(op.Width());
+    for (auto *v : {&x[j], &y[j], &y_ref[j], &xt[j], &yt[j], &yt_ref[j]})
+    {
+      v->UseDevice(true);
+    }
+    linalg::SetRandom(comm, x[j], 2 * j + 1);
+    linalg::SetRandom(comm, xt[j], 2 * j + 2);
+    X[j] = &x[j];
+    Y[j] = &y[j];
+    XT[j] = &xt[j];
+    YT[j] = &yt[j];
+  }
+  auto CheckColumns = [&](const std::vector<Vector> &v, std::vector<Vector> &v_ref)
+  {
+    for (int j = 0; j < n; j++)
+    {
+      const double ref_norm = linalg::Norml2(comm, v_ref[j]);
+      v_ref[j] -= v[j];
+      CHECK(linalg::Norml2(comm, v_ref[j]) <= 1.0e-12 * ref_norm);
+    }
+  };
+
+  // Y = A X.
+  op.ArrayMult(X, Y);
+  for (int j = 0; j < n; j++)
+  {
+    op.Mult(x[j], y_ref[j]);
+  }
+  CheckColumns(y, y_ref);
+
+  // Y += a A X, starting from the previous result.
+  constexpr double a = 0.5;
+  op.ArrayAddMult(X, Y, a);
+  for (int j = 0; j < n; j++)
+  {
+    op.Mult(x[j], y_ref[j]);
+    y_ref[j] *= 1.0 + a;
+  }
+  CheckColumns(y, y_ref);
+
+  // Y = Aᵀ X.
+  op.ArrayMultTranspose(XT, YT);
+  for (int j = 0; j < n; j++)
+  {
+    op.MultTranspose(xt[j], yt_ref[j]);
+  }
+  CheckColumns(yt, yt_ref);
+
+  // Y += a Aᵀ X, starting from the previous result.
+  op.ArrayAddMultTranspose(XT, YT, a);
+  for (int j = 0; j < n; j++)
+  {
+    op.MultTranspose(xt[j], yt_ref[j]);
+    yt_ref[j] *= 1.0 + a;
+  }
+  CheckColumns(yt, yt_ref);
+}
+
+}  // namespace
+
+TEST_CASE("ParOperator Multiple-Vector Application", "[ParOperator][Serial][Parallel]")
+{
+  // Blocks of one to five columns exercise the paired application of the local operator
+  // as well as the single-column path for a trailing odd column.
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 3, order = 2, dim = 3;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  Mesh mesh(std::make_unique<mfem::ParMesh>(comm, smesh));
+  mfem::H1_FECollection h1_fec(order, dim);
+  mfem::ND_FECollection nd_fec(order, dim);
+  FiniteElementSpace h1_fespace(mesh, &h1_fec), nd_fespace(mesh, &nd_fec);
+  mfem::Array<int> dbc_marker(mesh.Get().bdr_attributes.Max()), dbc_tdof_list;
+  dbc_marker = 0;
+  dbc_marker[0] = dbc_marker[5] = 1;
+  nd_fespace.Get().GetEssentialTrueDofs(dbc_marker, dbc_tdof_list);
+  const int n_cols = GENERATE(1, 2, 3, 4, 5);
+  INFO("Columns: " << n_cols);
+
+  SECTION("Square operator with essential boundary conditions")
+  {
+    BilinearForm a(nd_fespace);
+    a.AddDomainIntegrator<CurlCurlIntegrator>();
+    a.AddDomainIntegrator<VectorFEMassIntegrator>();
+    for (auto policy : {Operator::DiagonalPolicy::DIAG_ONE,
+                        Operator::DiagonalPolicy::DIAG_ZERO})
+    {
+      ParOperator A(a.PartialAssemble(), nd_fespace);
+      A.SetEssentialTrueDofs(dbc_tdof_list, policy);
+      CheckArrayMult(comm, A, n_cols);
+    }
+  }
+
+  SECTION("Rectangular operator")
+  {
+    BilinearForm a(h1_fespace, nd_fespace);
+    a.AddDomainIntegrator<MixedVectorGradientIntegrator>();
+    ParOperator A(a.PartialAssemble(), h1_fespace, nd_fespace, false);
+    CheckArrayMult(comm, A, n_cols);
+  }
+}
+
+TEST_CASE("ComplexParOperator Real-Valued Parts", "[ParOperator][Serial][Parallel]")
+{
+  // The complex-valued operator with real-valued local parts applies them to the real and
+  // imaginary parts of the input as a block, which must agree with the separate
+  // applications of the real-valued parallel operators.
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 3, order = 2, dim = 3;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  Mesh mesh(std::make_unique<mfem::ParMesh>(comm, smesh));
+  mfem::ND_FECollection nd_fec(order, dim);
+  FiniteElementSpace nd_fespace(mesh, &nd_fec);
+  mfem::Array<int> dbc_marker(mesh.Get().bdr_attributes.Max()), dbc_tdof_list;
+  dbc_marker = 1;
+  nd_fespace.Get().GetEssentialTrueDofs(dbc_marker, dbc_tdof_list);
+
+  BilinearForm ar(nd_fespace), ai(nd_fespace);
+  ar.AddDomainIntegrator<CurlCurlIntegrator>();
+  ai.AddDomainIntegrator<VectorFEMassIntegrator>();
+  auto Ar = ar.PartialAssemble(), Ai = ai.PartialAssemble();
+  ComplexParOperator A(Ar.get(), Ai.get(), nd_fespace);
+  A.SetEssentialTrueDofs(dbc_tdof_list, Operator::DiagonalPolicy::DIAG_ONE);
+
+  const int size = A.Height();
+  ComplexVector x(size), y(size), y_ref(size);
+  Vector t(size);
+  x.UseDevice(true);
+  y.UseDevice(true);
+  y_ref.UseDevice(true);
+  t.UseDevice(true);
+  linalg::SetRandom(comm, x, 1);
+
+  // y = (Ar + i Ai) x, for x = xr + i xi.
+  A.Mult(x, y);
+  A.Real()->Mult(x.Real(), y_ref.Real());
+  A.Imag()->Mult(x.Imag(), t);
+  y_ref.Real() -= t;
+  A.Real()->Mult(x.Imag(), y_ref.Imag());
+  A.Imag()->Mult(x.Real(), t);
+  y_ref.Imag() += t;
+  const double ref_norm = linalg::Norml2(comm, y_ref);
+  y_ref -= y;
+  CHECK(linalg::Norml2(comm, y_ref) <= 1.0e-12 * ref_norm);
+}
+
+}  // namespace palace
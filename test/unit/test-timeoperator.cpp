@@ -0,0 +1,193 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "fem/mesh.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+#include "models/spaceoperator.hpp"
+#include "models/timeoperator.hpp"
+#include "utils/communication.hpp"
+#include "utils/iodata.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+// Unit cube with a lumped port on the bottom face (boundary attribute 1) and PEC on the top
+// face (boundary attribute 6), with the remaining boundaries left as natural (PMC).
+auto Initialize(MPI_Comm comm, IoData &iodata)
+{
+  constexpr int n = 4;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  auto pmesh = std::make_unique<mfem::ParMesh>(comm, smesh);
+
+  iodata.problem.type = ProblemType::TRANSIENT;
+  iodata.model.L0 = 1.0;
+  iodata.domains.attributes = {1};
+  auto &material = iodata.domains.materials.emplace_back();
+  material.attributes = {1};
+  iodata.boundaries.pec.attributes = {6};
+  auto &port = iodata.boundaries.lumpedport[1];
+  port.R = 50.0;
+  port.excitation = 1;
+  auto &element = port.elements.emplace_back();
+  element.direction = {1.0, 0.0, 0.0};
+  element.attributes = {1};
+  iodata.solver.order = 2;
+  iodata.solver.linear.tol = 1.0e-10;
+  iodata.NondimensionalizeInputs(*pmesh);
+
+  std::vector<std::unique_ptr<Mesh>> mesh;
+  mesh.push_back(std::make_unique<Mesh>(std::move(pmesh)));
+  return mesh;
+}
+
+}  // namespace
+
+TEST_CASE("Transient Implicit B-Field Update", "[TimeOperator][Serial][Parallel]")
+{
+  // The generalized-α integrator with ρ∞ = 1 is the implicit midpoint rule, so the B-field
+  // update from dB/dt = -∇ x E must satisfy B_{n+1} - B_n = -Δt/2 ∇ x (E_n + E_{n+1})
+  // exactly, independent of the tolerance of the linear solves for the E-field. This
+  // requires the stage derivative k3 = rhs3 - Δt ∇ x k2 in the implicit solve.
+  MPI_Comm comm = Mpi::World();
+  IoData iodata(Units(1.0, 1.0));
+  iodata.solver.transient.type = TimeSteppingScheme::GEN_ALPHA;
+  auto mesh = Initialize(comm, iodata);
+  SpaceOperator space_op(iodata, mesh);
+  TimeOperator time_op(iodata, space_op, [](double t) { return std::cos(t); });
+  const auto &Curl = space_op.GetCurlMatrix();
+
+  constexpr int n_step = 5;
+  double t = 0.0, dt = 0.1;
+  Vector E0(time_op.GetE().Size()), B0(time_op.GetB().Size()), dB(B0.Size());
+  E0.UseDevice(true);
+  B0.UseDevice(true);
+  dB.UseDevice(true);
+  time_op.Init();
+  for (int step = 0; step < n_step; step++)
+  {
+    E0 = time_op.GetE();
+    B0 = time_op.GetB();
+    time_op.Step(t, dt);
+
+    // dB = B_{n+1} - B_n, and the residual of the midpoint rule.
+    linalg::AXPBYPCZ(1.0, time_op.GetB(), -1.0, B0, 0.0, dB);
+    const double dB_norm = linalg::Norml2(comm, dB);
+    REQUIRE(dB_norm > 0.0);
+    E0 += time_op.GetE();
+    Curl.AddMult(E0, dB, 0.5 * dt);
+    CHECK(linalg::Norml2(comm, dB) <= 1.0e-10 * dB_norm);
+  }
+}
+
+TEST_CASE("Transient Preconditioner Reuse", "[TimeOperator][Serial][Parallel]")
+{
+  // The preconditioner is only reconstructed when the time step changes by more than the
+  // allowed ratio since it was built, and the solution with a reused preconditioner agrees
+  // with the one where the preconditioner is rebuilt for every change of the time step.
+  MPI_Comm comm = Mpi::World();
+  IoData iodata(Units(1.0, 1.0));
+  iodata.solver.transient.type = TimeSteppingScheme::GEN_ALPHA;
+  iodata.solver.transient.pc_update_it = 1.0e3;
+  auto mesh = Initialize(comm, iodata);
+  SpaceOperator space_op(iodata, mesh);
+  auto dJ_coef = [](double t) { return std::cos(t); };
+  iodata.solver.transient.pc_update_ratio = 2.0;
+  TimeOperator time_op(iodata, space_op, dJ_coef);
+  iodata.solver.transient.pc_update_ratio = 1.0;
+  TimeOperator time_op_ref(iodata, space_op, dJ_coef);
+
+  const std::vector<double> dts = {0.1, 0.1, 0.15, 0.5};
+  const std::vector<int> num_updates = {1, 1, 1, 2}, num_updates_ref = {1, 1, 2, 3};
+  double t = 0.0, t_ref = 0.0;
+  Vector dE(time_op.GetE().Size());
+  dE.UseDevice(true);
+  time_op.Init();
+  time_op_ref.Init();
+  for (std::size_t step = 0; step < dts.size(); step++)
+  {
+    double dt = dts[step], dt_ref = dts[step];
+    time_op.Step(t, dt);
+    time_op_ref.Step(t_ref, dt_ref);
+    CHECK(time_op.NumPreconditionerUpdates() == num_updates[step]);
+    CHECK(time_op_ref.NumPreconditionerUpdates() == num_updates_ref[step]);
+
+    linalg::AXPBYPCZ(1.0, time_op.GetE(), -1.0, time_op_ref.GetE(), 0.0, dE);
+    const double E_norm = linalg::Norml2(comm, time_op_ref.GetE());
+    REQUIRE(E_norm > 0.0);
+    CHECK(linalg::Norml2(comm, dE) <= 1.0e-8 * E_norm);
+  }
+}
+
+TEST_CASE("Transient Leapfrog Lumped Mass", "[TimeOperator][Serial][Parallel]")
+{
+  // The lumped mass matrix M_L is positive and bounds the consistent one from above, and
+  // the leapfrog scheme is stable below the estimated time step limit and unstable above
+  // it.
+  MPI_Comm comm = Mpi::World();
+  IoData iodata(Units(1.0, 1.0));
+  iodata.solver.transient.leapfrog = true;
+  auto mesh = Initialize(comm, iodata);
+  iodata.solver.order = 1;
+  SpaceOperator space_op(iodata, mesh);
+  auto K = space_op.GetStiffnessMatrix<Operator>(Operator::DIAG_ZERO);
+  auto M = space_op.GetMassMatrix<Operator>(Operator::DIAG_ONE);
+  Vector Minv;
+  TimeOperator::GetLumpedMassInverse(*M, Minv);
+  REQUIRE(Minv.Size() == M->Height());
+  {
+    const double *h_Minv = Minv.HostRead();
+    CHECK(std::all_of(h_Minv, h_Minv + Minv.Size(), [](double d) { return d > 0.0; }));
+  }
+  Vector x(M->Height()), y(M->Height());
+  x.UseDevice(true);
+  y.UseDevice(true);
+  for (int seed = 1; seed <= 3; seed++)
+  {
+    linalg::SetRandom(comm, x, seed);
+    M->Mult(x, y);
+    const double xMx = linalg::Dot(comm, x, y);
+    double xMLx = 0.0;
+    const double *h_x = x.HostRead(), *h_Minv = Minv.HostRead();
+    for (int i = 0; i < x.Size(); i++)
+    {
+      xMLx += h_x[i] * h_x[i] / h_Minv[i];
+    }
+    Mpi::GlobalSum(1, &xMLx, comm);
+    CHECK(xMLx >= xMx);
+  }
+
+  const double dt_max = TimeOperator::GetLeapfrogTimeStepLimit(comm, *K, Minv);
+  REQUIRE(dt_max > 0.0);
+  auto GetFieldNorm = [&](double dt)
+  {
+    constexpr int n_step = 200;
+    TimeOperator time_op(iodata, space_op, [](double t) { return std::cos(t); });
+    time_op.Init();
+    double t = 0.0;
+    for (int step = 0; step < n_step; step++)
+    {
+      time_op.Step(t, dt);
+    }
+    return linalg::Norml2(comm, time_op.GetE());
+  };
+  iodata.solver.transient.delta_t = 0.5 * dt_max;
+  const double E_stable = GetFieldNorm(0.5 * dt_max);
+  const double E_unstable = GetFieldNorm(1.2 * dt_max);
+  CHECK(std::isfinite(E_stable));
+  CHECK(E_stable > 0.0);
+  CHECK(!(E_unstable < 1.0e6 * E_stable));
+}
+
+}  // namespace palace
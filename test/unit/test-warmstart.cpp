@@ -0,0 +1,172 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "drivers/basesolver.hpp"
+#include "fem/bilinearform.hpp"
+#include "fem/errorindicator.hpp"
+#include "fem/fespace.hpp"
+#include "fem/integrator.hpp"
+#include "fem/mesh.hpp"
+#include "linalg/iterative.hpp"
+#include "linalg/jacobi.hpp"
+#include "linalg/rap.hpp"
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+#include "utils/iodata.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+// Exposes the storage and transfer of the AMR warm start solutions of the base driver.
+class WarmStartSolver : public BaseSolver
+{
+protected:
+  std::pair<ErrorIndicator, long long int>
+  Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const override
+  {
+    return {ErrorIndicator(), 0};
+  }
+
+public:
+  using BaseSolver::BaseSolver;
+  using BaseSolver::GetWarmStart;
+  using BaseSolver::NumWarmStart;
+  using BaseSolver::SaveWarmStart;
+  using BaseSolver::UpdateWarmStart;
+};
+
+// Laplace problem with V = 1 on boundary attribute 1 and V = 0 on the rest of the boundary,
+// with the Dirichlet lifting in X and the eliminated right-hand side in RHS, as for the
+// electrostatic driver.
+struct LaplaceSystem
+{
+  mfem::H1_FECollection fec;
+  FiniteElementSpace fespace;
+  mfem::Array<int> dbc_tdof_list;
+  std::unique_ptr<ParOperator> K;
+  Vector X, RHS;
+
+  LaplaceSystem(Mesh &mesh, int order)
+    : fec(order, mesh.Get().Dimension()), fespace(mesh, &fec)
+  {
+    const auto &pmesh = mesh.Get();
+    mfem::Array<int> dbc_marker(pmesh.bdr_attributes.Max()), source_marker;
+    dbc_marker = 1;
+    fespace.Get().GetEssentialTrueDofs(dbc_marker, dbc_tdof_list);
+    BilinearForm k(fespace);
+    k.AddDomainIntegrator<DiffusionIntegrator>();
+    K = std::make_unique<ParOperator>(k.PartialAssemble(), fespace);
+    K->SetEssentialTrueDofs(dbc_tdof_list, Operator::DiagonalPolicy::DIAG_ONE);
+
+    mfem::ParGridFunction x(&fespace.Get());
+    x = 0.0;
+    source_marker.SetSize(dbc_marker.Size());
+    source_marker = 0;
+    source_marker[0] = 1;
+    mfem::ConstantCoefficient one(1.0);
+    x.ProjectBdrCoefficient(one, source_marker);
+    X.SetSize(fespace.GetTrueVSize());
+    RHS.SetSize(fespace.GetTrueVSize());
+    X.UseDevice(true);
+    RHS.UseDevice(true);
+    X = 0.0;
+    RHS = 0.0;
+    x.ParallelProject(X);
+    K->EliminateRHS(X, RHS);
+  }
+
+  // Solves with Jacobi-preconditioned CG starting from the given initial guess, and returns
+  // the number of iterations.
+  int Solve(MPI_Comm comm, Vector &x) const
+  {
+    JacobiSmoother<Operator> jacobi(comm);
+    jacobi.SetOperator(*K);
+    CgSolver<Operator> cg(comm, 0);
+    cg.SetRelTol(1.0e-10);
+    cg.SetMaxIter(10000);
+    cg.SetOperator(*K);
+    cg.SetPreconditioner(jacobi);
+    cg.SetInitialGuess(true);
+    cg.Mult(RHS, x);
+    REQUIRE(cg.GetConverged());
+    return cg.GetNumIterations();
+  }
+};
+
+}  // namespace
+
+TEST_CASE("AMR Warm Start Dirichlet Values", "[WarmStart][Serial][Parallel]")
+{
+  // The solution on the coarse mesh is transferred to a nonconforming refinement. The
+  // transferred solution does not match the prescribed values at the new boundary dofs
+  // near the edges where the boundary values jump, and these are restored from the
+  // Dirichlet lifting of the new solve. The warm start reduces the number of iterations
+  // compared to starting from the lifting alone.
+  MPI_Comm comm = Mpi::World();
+  constexpr int n = 4, order = 2;
+  mfem::Mesh smesh =
+      mfem::Mesh::MakeCartesian3D(n, n, n, mfem::Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+  REQUIRE(Mpi::Size(comm) <= smesh.GetNE());
+  Mesh mesh(std::make_unique<mfem::ParMesh>(comm, smesh));
+
+  IoData iodata(Units(1.0, 1.0));
+  iodata.model.refinement.max_it = 1;
+  WarmStartSolver solver(iodata, false);
+  {
+    LaplaceSystem coarse(mesh, order);
+    Vector V(coarse.X);
+    coarse.Solve(comm, V);
+    solver.SaveWarmStart(coarse.fespace, V, 0);
+  }
+
+  // Refine the elements near the boundary with the nonzero prescribed value.
+  {
+    mfem::ParMesh &fine_mesh = mesh;
+    mfem::Array<int> marked_elements;
+    for (int i = 0; i < fine_mesh.GetNE(); i++)
+    {
+      mfem::Vector c;
+      fine_mesh.GetElementCenter(i, c);
+      if (c(2) < 0.5)
+      {
+        marked_elements.Append(i);
+      }
+    }
+    fine_mesh.GeneralRefinement(marked_elements, 1);
+    REQUIRE(fine_mesh.Nonconforming());
+    mesh.Update();
+    solver.UpdateWarmStart(mesh.Get());
+  }
+
+  LaplaceSystem fine(mesh, order);
+  REQUIRE(solver.NumWarmStart(fine.fespace) == 1);
+  auto BoundaryError = [&](const Vector &v)
+  {
+    Vector e(fine.dbc_tdof_list.Size()), e_ref(fine.dbc_tdof_list.Size());
+    v.GetSubVector(fine.dbc_tdof_list, e);
+    fine.X.GetSubVector(fine.dbc_tdof_list, e_ref);
+    e -= e_ref;
+    return linalg::Norml2(comm, e);
+  };
+  Vector V0(fine.X), V(fine.X), V_raw(fine.X);
+  solver.GetWarmStart(fine.fespace, 0, V, &fine.dbc_tdof_list);
+  solver.GetWarmStart(fine.fespace, 0, V_raw);
+  CHECK(BoundaryError(V) == 0.0);
+  CHECK(BoundaryError(V_raw) > 0.0);
+
+  const int it_lift = fine.Solve(comm, V0);
+  const int it_warm = fine.Solve(comm, V);
+  CHECK(it_warm < it_lift);
+  V -= V0;
+  CHECK(linalg::Norml2(comm, V) <= 1.0e-6 * linalg::Norml2(comm, V0));
+}
+
+}  // namespace palace